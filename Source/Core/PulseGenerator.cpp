@@ -0,0 +1,184 @@
+#include "PulseGenerator.h"
+
+#include <cmath>
+
+PulseGenerator::PulseGenerator()
+{
+}
+
+void PulseGenerator::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+    // Update pulse duration based on sample rate and pulse width
+    updatePulseDuration();
+    reset();
+    updatePulseRate();
+}
+
+void PulseGenerator::reset()
+{
+    currentPosition = 0.0;
+    nextPulseTime = 0.0;
+    currentPulsePosition = 0;
+    pulseActive = false;
+    pulseIndex = -1;
+    lastHostBPM = hostBPM;
+    hasExpectedPPQPosition = false;
+    updatePulseRate();
+}
+
+void PulseGenerator::setSampleRate(double newSampleRate)
+{
+    // Update sample rate if it changed
+    if (newSampleRate != sampleRate && newSampleRate > 0.0)
+    {
+        // The timeline is counted in samples: rescale it so the next pulse lands at the same musical time
+        const double ratio = newSampleRate / sampleRate;
+        currentPosition *= ratio;
+        nextPulseTime *= ratio;
+        expectedSamplesPerQuarter *= ratio;
+        if (currentPulsePosition > 0) // A sounding pulse must not drop back to its (silent) first sample
+            currentPulsePosition = std::max(1, static_cast<int>(currentPulsePosition * ratio));
+
+        sampleRate = newSampleRate;
+        updatePulseDuration(); // Update pulse duration based on new sample rate
+        updatePulseRate();
+
+        if (currentPulsePosition >= pulseDurationSamples)
+        {
+            pulseActive = false;
+            currentPulsePosition = 0;
+        }
+    }
+}
+
+void PulseGenerator::updatePulseRate()
+{
+    double currentBPM = getCurrentBPM();
+    rateBPM = currentBPM;
+
+    // Ensure BPM is valid (also rejects NaN from a misbehaving host)
+    if (!(currentBPM > 0.0))
+        currentBPM = 120.0;
+
+    // Calculate pulses per second correctly
+    // BPM = beats per minute
+    // For 24 PPQN (pulses per quarter note, the default):
+    // pulses per second = (BPM / 60) * 24
+    pulseRate = (currentBPM / SECONDS_PER_MINUTE) * pulsesPerQuarterNote;
+
+    // Calculate samples between pulses
+    pulseInterval = sampleRate / pulseRate;
+    samplesPerPulse = pulseInterval;
+
+    // Ensure we don't have negative or zero intervals
+    if (pulseInterval <= 0.0)
+        pulseInterval = sampleRate; // Fallback to 1 pulse per second
+}
+
+bool PulseGenerator::detectTempoChange()
+{
+    // Check if we're in sync mode and tempo has changed
+    if (syncToHost)
+    {
+        // Detect significant tempo change
+        if (std::abs(hostBPM - lastHostBPM) > TEMPO_CHANGE_THRESHOLD)
+        {
+            return true;
+        }
+        
+        // Also check for PPQ position jumps (transport repositioned, looped or rewound,
+        // including back to 0) and for drift: the host is away from where our own
+        // timeline puts it by a quarter pulse, or by the jitter window if that is
+        // shorter. Smaller differences are host jitter and are ignored, so they cannot
+        // accumulate. The first block with a PPQ position aligns to it too.
+        if (hasHostPPQPosition)
+        {
+            if (!hasExpectedPPQPosition)
+                return true;
+
+            const double thresholdSamples = std::min(PPQ_RESYNC_PULSES * pulseInterval, getJitterSamples());
+            if (std::abs(getPPQDriftSamples()) > thresholdSamples)
+                return true;
+        }
+    }
+    return false;
+}
+
+void PulseGenerator::resyncTiming()
+{
+    // When tempo changes or transport jumps, resync our timing. Without a host PPQ
+    // position there is nothing to align to: the current phase is kept and the new
+    // rate takes over from the next pulse.
+    if (syncToHost && hasHostPPQPosition)
+    {
+        // Calculate which pulse we should be on based on PPQ position
+        double pulsesElapsed = hostPPQPosition * pulsesPerQuarterNote;
+        double wholePulses = std::floor(pulsesElapsed);
+        double fractionalPulse = pulsesElapsed - wholePulses;
+
+        // Tempo changes and jitter move the host by less than the jitter window. Keep
+        // the pulse count going: the next pulse is the one after the last one played,
+        // placed on the host grid, so a pulse that already sounded is never played again.
+        // An overdue pulse has a negative due time: it plays now and the ones after it
+        // stay on the grid.
+        if (hasExpectedPPQPosition && std::abs(getPPQDriftSamples()) <= getJitterSamples())
+        {
+            const auto lastDuePulse = static_cast<std::int64_t>(std::ceil(pulsesElapsed)) - 1;
+            pulseIndex = std::max(pulseIndex, lastDuePulse - 1); // Skip pulses more than one behind
+
+            currentPosition = 0.0;
+            nextPulseTime = (static_cast<double>(pulseIndex + 1) - pulsesElapsed) * pulseInterval;
+            lastHostBPM = hostBPM;
+            return;
+        }
+
+        // Transport jump, rewind or first alignment: reset position to align with current pulse
+        currentPosition = fractionalPulse * pulseInterval;
+        nextPulseTime = pulseInterval;
+        const auto hostPulse = static_cast<std::int64_t>(wholePulses);
+
+        // If we're in the middle of a pulse, adjust accordingly. Landing on the pulse
+        // that played last leaves it as it is: it has already sounded.
+        if (hostPulse != pulseIndex)
+        {
+            if (fractionalPulse < (pulseDurationSamples / pulseInterval))
+            {
+                pulseActive = true;
+                currentPulsePosition = static_cast<int>(fractionalPulse * pulseInterval);
+            }
+            else
+            {
+                pulseActive = false;
+                currentPulsePosition = 0;
+            }
+        }
+
+        pulseIndex = hostPulse;
+    }
+    
+    // Update last known values
+    lastHostBPM = hostBPM;
+}
+
+void PulseGenerator::trackHostPosition()
+{
+    if (syncToHost && hasHostPPQPosition)
+    {
+        // Our own position in pulses: the last pulse played, plus how far we are towards the next one
+        const double pulsesElapsed = static_cast<double>(pulseIndex + 1) - (nextPulseTime - currentPosition) / pulseInterval;
+        expectedPPQPosition = pulsesElapsed / pulsesPerQuarterNote;
+        expectedSamplesPerQuarter = pulsesPerQuarterNote * pulseInterval;
+        hasExpectedPPQPosition = true;
+    }
+    else
+    {
+        hasExpectedPPQPosition = false;
+    }
+}
+
+void PulseGenerator::updatePulseDuration()
+{
+    // Convert pulse width from milliseconds to samples
+    pulseDurationSamples = static_cast<int>(sampleRate * pulseWidthMs * 0.001);
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+// PulseGenerator
+// - Engine that generates a 1kHz pulse train at 24 PPQN (configurable)
+// - Supports host-sync via AudioPlayHead (BPM, playing state, PPQ position)
+// - Manual BPM mode when not synced to host
+// - Pulse width expressed in ms; converted to samples per current sample rate
+// - process() is templated over the sample type so float and double hosts share one engine
+// - Optional PulseTable supplies the precomputed pulse shape; falls back to direct evaluation
+// - JUCE-free (Pulse24SyncCore target): renders into raw channel pointers; the per-sample
+//   path is defined inline below so it can be optimized into each call site
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "PulseTable.h"
+
+class PulseGenerator
+{
+public:
+    PulseGenerator();
+    ~PulseGenerator() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    // Adds the pulse train to numChannels channels of numSamples samples (float or double).
+    // Uses the sample rate from prepare()/setSampleRate().
+    template <typename SampleType>
+    void process(SampleType* const* channels, int numChannels, int numSamples);
+
+    // Convenience for buffer types with getArrayOfWritePointers()/getNumChannels() (e.g. juce::AudioBuffer)
+    template <typename BufferType>
+    void process(int numSamples, double currentSampleRate, BufferType& audioBuffer)
+    {
+        setSampleRate(currentSampleRate);
+        process(audioBuffer.getArrayOfWritePointers(), audioBuffer.getNumChannels(), numSamples);
+    }
+
+    // Recomputes pulse duration and rate if the rate differs from the current one; the
+    // running timeline is rescaled so pulses stay on the same musical grid
+    void setSampleRate(double newSampleRate);
+
+    // Parameter setters
+    void setEnabled(bool enabled) { isEnabled = enabled; }
+    void setPulseVelocity(float velocity) { pulseVelocity = std::clamp(velocity / 127.0f, 0.0f, 1.0f); } // Convert MIDI velocity to gain
+    void setPulseWidth(float widthMs) { pulseWidthMs = std::clamp(widthMs, 1.0f, 50.0f); updatePulseDuration(); } // Set pulse width in milliseconds
+    void setSyncToHost(bool sync) { syncToHost = sync; }
+    void setManualBPM(float bpm) { manualBPM = bpm; }
+    void setPulsesPerQuarterNote(double ppqn) { pulsesPerQuarterNote = std::clamp(ppqn, 1.0, 960.0); updatePulseRate(); }
+
+    // Precomputed pulse shape (owned elsewhere, must outlive its use here). Only used
+    // while it matches the current sample rate and pulse duration; nullptr disables it.
+    void setPulseTable(const PulseTable* table) { pulseTable = table; }
+    bool hasMatchingPulseTable() const { return pulseTable != nullptr && pulseTable->matches(sampleRate, pulseDurationSamples); }
+
+    // Host tempo synchronization
+    void setHostTempo(double bpm) { hostBPM = bpm; }
+    void setHostIsPlaying(bool playing) { hostIsPlaying = playing; }
+    void setHostPosition(double timeInSeconds) { hostPosition = timeInSeconds; }
+    void setHostPPQPosition(double ppq) { hostPPQPosition = ppq; hasHostPPQPosition = true; }
+    void clearHostPPQPosition() { hostPPQPosition = 0.0; hasHostPPQPosition = false; } // Host reports no PPQ: free-run
+
+    // Getters for UI
+    bool getEnabled() const { return isEnabled; }
+    float getPulseVelocity() const { return pulseVelocity * 127.0f; } // Convert back to MIDI scale for UI
+    float getPulseWidth() const { return pulseWidthMs; }
+    bool getSyncToHost() const { return syncToHost; }
+    float getManualBPM() const { return manualBPM; }
+    double getCurrentBPM() const { return syncToHost ? hostBPM : manualBPM; }
+    double getPulseRate() const { return pulseRate; }
+    double getPulsesPerQuarterNote() const { return pulsesPerQuarterNote; }
+    bool getHostIsPlaying() const { return hostIsPlaying; }
+    int getPulseDurationSamples() const { return pulseDurationSamples; }
+    bool isPulseActive() const { return pulseActive; } // True while a pulse (or its tail after stop) is still sounding
+
+    // Index of the most recently started pulse since reset (-1 = none yet). After a resync
+    // to the host PPQ position it counts pulses from PPQ 0, so index / PPQN is the beat.
+    std::int64_t getPulseIndex() const { return pulseIndex; }
+
+private:
+    // Parameters
+    bool isEnabled = true;
+    float pulseVelocity = 100.0f / 127.0f; // Store as gain (0.0 to 1.0)
+    float pulseWidthMs = 22.0f; // Pulse width in milliseconds
+    bool syncToHost = true;
+    float manualBPM = 120.0f;
+
+    // Host tempo info
+    double hostBPM = 120.0;
+    bool hostIsPlaying = false;
+    double hostPosition = 0.0;     // Seconds
+    double hostPPQPosition = 0.0;  // PPQ position from DAW
+    bool hasHostPPQPosition = false;
+    double lastHostBPM = 120.0;    // Track tempo changes
+    double expectedPPQPosition = 0.0;  // Where the engine's own timeline puts the host at the next block
+    bool hasExpectedPPQPosition = false;
+    double expectedSamplesPerQuarter = 0.0; // Tempo the prediction was made at (see getPPQDriftSamples)
+    double rateBPM = 0.0;          // Tempo the current pulseInterval was computed for
+
+    // Timing (sample-domain)
+    double sampleRate = 44100.0;
+    double pulseRate = 0.0;        // pulses per second
+    double pulseInterval = 0.0;    // samples between pulses
+    double currentPosition = 0.0;  // current position in samples
+    double nextPulseTime = 0.0;    // time of next pulse in samples
+    double pulsesPerQuarterNote = 24.0;  // Standard MIDI clock rate
+    double samplesPerPulse = 0.0;  // Samples per pulse at current tempo
+
+    // Audio generation
+    int pulseDurationSamples = 1000; // Duration of each pulse in samples (about 22ms at 44.1kHz)
+    int currentPulsePosition = 0; // Current position within a pulse
+    bool pulseActive = false; // Whether we're currently generating a pulse
+    std::int64_t pulseIndex = -1; // Most recently started pulse (see getPulseIndex)
+    const PulseTable* pulseTable = nullptr; // Optional precomputed pulse shape
+    const float* activeShape = nullptr;     // pulseTable data when it matches the current settings
+
+    // Constants
+    static constexpr double SECONDS_PER_MINUTE = 60.0;
+    static constexpr double TEMPO_CHANGE_THRESHOLD = 0.1; // Detect tempo changes > 0.1 BPM
+    static constexpr double PPQ_JITTER_SECONDS = 0.002;    // Host PPQ this close to the prediction is jitter, not a jump
+    static constexpr double PPQ_RESYNC_PULSES = 0.25;      // Phase error (in pulses) that triggers a resync within the jitter window
+    static constexpr double RATE_BPM_TOLERANCE = 1e-9;     // Tempo difference below which pulseInterval is still current
+
+    // Helper methods
+    void updatePulseRate();
+    template <typename SampleType>
+    void generateAudioPulse(SampleType* const* channels, int numChannels, int startSample, int numSamples); // Renders the remainder of an active pulse
+    float generatePulseSample(int sampleIndex) const;
+    bool detectTempoChange();  // Detect tempo changes and transport jumps (loops, rewinds, relocation)
+    void resyncTiming();       // Resynchronize timing when tempo changes
+    void trackHostPosition();  // Predicts the next block's PPQ position for jump detection
+    // Host PPQ minus the prediction, in samples. Across a tempo change the host's error may be
+    // in either tempo, so the shorter of the two readings counts.
+    double getPPQDriftSamples() const
+    {
+        return (hostPPQPosition - expectedPPQPosition) * std::min(expectedSamplesPerQuarter, pulsesPerQuarterNote * pulseInterval);
+    }
+    double getJitterSamples() const { return PPQ_JITTER_SECONDS * sampleRate; }
+    // True when the tempo moved since pulseInterval was computed (a NaN on either side counts as moved)
+    bool isPulseRateStale() const { return !(std::abs(getCurrentBPM() - rateBPM) <= RATE_BPM_TOLERANCE); }
+    void updatePulseDuration(); // Update pulse duration based on current pulse width
+    void updateActiveShape();   // Selects the pulse table if it matches sample rate and duration
+};
+
+//==============================================================================
+// Per-sample rendering (inline so the hot loop is visible to every call site)
+
+template <typename SampleType>
+void PulseGenerator::process(SampleType* const* channels, int numChannels, int numSamples)
+{
+    updateActiveShape();
+
+    if (!isEnabled || !hostIsPlaying)
+    {
+        // Let a pulse that was already sounding decay naturally rather than cutting it off
+        if (pulseActive)
+            generateAudioPulse(channels, numChannels, 0, numSamples);
+
+        hasExpectedPPQPosition = false; // Realign to the host when playback resumes
+        return;
+    }
+
+    // Detect and handle tempo changes
+    if (detectTempoChange())
+    {
+        updatePulseRate();
+        resyncTiming();
+    }
+    else if (isPulseRateStale())
+    {
+        updatePulseRate(); // Manual BPM edits and sub-threshold host drift: keep the phase, change the rate
+    }
+
+    // Process each sample
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        // Check if it's time for a new pulse. A pulse wider than the pulse interval is
+        // cut short by the next one, so every tick still starts on the grid.
+        if (currentPosition >= nextPulseTime)
+        {
+            pulseActive = true;
+            currentPulsePosition = 0;
+            nextPulseTime += pulseInterval;
+            ++pulseIndex;
+        }
+
+        // Generate audio for active pulse
+        if (pulseActive)
+        {
+            auto pulseSample = static_cast<SampleType>(generatePulseSample(currentPulsePosition));
+
+            // Add to all output channels
+            for (int channel = 0; channel < numChannels; ++channel)
+                channels[channel][sample] += pulseSample;
+
+            currentPulsePosition++;
+
+            // Check if pulse is finished
+            if (currentPulsePosition >= pulseDurationSamples)
+            {
+                pulseActive = false;
+                currentPulsePosition = 0;
+            }
+        }
+
+        currentPosition += 1.0;
+    }
+
+    trackHostPosition();
+}
+
+template <typename SampleType>
+void PulseGenerator::generateAudioPulse(SampleType* const* channels, int numChannels, int startSample, int numSamples)
+{
+    // Used when the transport stops or the generator is disabled mid-pulse:
+    // finish the current pulse without advancing the timeline
+    const int endSample = startSample + numSamples;
+
+    for (int sample = startSample; sample < endSample && pulseActive; ++sample)
+    {
+        auto pulseSample = static_cast<SampleType>(generatePulseSample(currentPulsePosition));
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            channels[channel][sample] += pulseSample;
+
+        if (++currentPulsePosition >= pulseDurationSamples)
+        {
+            pulseActive = false;
+            currentPulsePosition = 0;
+        }
+    }
+}
+
+inline float PulseGenerator::generatePulseSample(int sampleIndex) const
+{
+    if (sampleIndex >= pulseDurationSamples)
+        return 0.0f;
+
+    const float shape = activeShape != nullptr ? activeShape[sampleIndex]
+                                               : PulseTable::shapeAt(sampleIndex, pulseDurationSamples, sampleRate);
+
+    return shape * pulseVelocity * 0.1f; // Scale down to prevent clipping
+}
+
+inline void PulseGenerator::updateActiveShape()
+{
+    activeShape = hasMatchingPulseTable() ? pulseTable->data() : nullptr;
+}
@@ -0,0 +1,41 @@
+#include "PulseTable.h"
+
+#include <cmath>
+
+PulseTable::PulseTable(double newSampleRate, int durationSamples, Waveform newWaveform)
+    : sampleRate(newSampleRate), waveform(newWaveform)
+{
+    samples.resize(static_cast<size_t>(durationSamples > 0 ? durationSamples : 0));
+
+    for (int i = 0; i < size(); ++i)
+        samples[static_cast<size_t>(i)] = shapeAt(i, durationSamples, sampleRate);
+}
+
+float PulseTable::shapeAt(int sampleIndex, int durationSamples, double sampleRate)
+{
+    constexpr float pi = 3.141592653589793238f;
+
+    if (sampleIndex >= durationSamples)
+        return 0.0f;
+
+    const auto index = static_cast<float>(sampleIndex);
+    const auto duration = static_cast<float>(durationSamples);
+
+    // Generate sine wave at 1 kHz
+    float phase = (2.0f * pi * PULSE_FREQUENCY * index) / static_cast<float>(sampleRate);
+    float sineWave = std::sin(phase);
+
+    // Apply envelope (quick attack, exponential decay)
+    float envelope = 1.0f;
+    if (index < duration * 0.1f) // 10% attack
+    {
+        envelope = index / (duration * 0.1f);
+    }
+    else // 90% decay
+    {
+        float decayPosition = (index - duration * 0.1f) / (duration * 0.9f);
+        envelope = std::exp(-5.0f * decayPosition); // Exponential decay
+    }
+
+    return sineWave * envelope;
+}
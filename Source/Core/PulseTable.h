@@ -0,0 +1,43 @@
+#pragma once
+
+// PulseTable
+// - Immutable, precomputed unit-gain pulse shape (1kHz sine x attack/decay envelope)
+//   for one sample rate and pulse length in samples
+// - Built off the audio thread; the engine reads it instead of evaluating sin/exp per sample
+// - shapeAt() is the single definition of the waveform, used for both tables and direct rendering
+
+#include <functional>
+#include <vector>
+
+class PulseTable
+{
+public:
+    enum class Waveform
+    {
+        sine1kHz // 1kHz sine, 10% linear attack, exponential decay
+    };
+
+    PulseTable(double sampleRate, int durationSamples, Waveform waveform = Waveform::sine1kHz);
+
+    // Unit-gain pulse sample at sampleIndex for a pulse of durationSamples
+    static float shapeAt(int sampleIndex, int durationSamples, double sampleRate);
+
+    bool matches(double otherSampleRate, int otherDurationSamples) const noexcept
+    {
+        // Exact match on purpose: tables are keyed by the rate they were built for.
+        // std::equal_to keeps JUCE targets' -Wfloat-equal quiet when they include this header.
+        return std::equal_to<double>()(otherSampleRate, sampleRate) && otherDurationSamples == size();
+    }
+
+    const float* data() const noexcept { return samples.data(); }
+    int size() const noexcept { return static_cast<int>(samples.size()); }
+    double getSampleRate() const noexcept { return sampleRate; }
+    Waveform getWaveform() const noexcept { return waveform; }
+
+private:
+    double sampleRate;
+    Waveform waveform;
+    std::vector<float> samples;
+
+    static constexpr float PULSE_FREQUENCY = 1000.0f; // 1kHz sine wave for pulses
+};
@@ -0,0 +1,148 @@
+#include "TempoMap.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+TempoMap::TempoMap(double constantBPM)
+{
+    changes.push_back({ 0.0, constantBPM > 0.0 ? constantBPM : 120.0, 0.0 });
+}
+
+void TempoMap::addChange(double ppqPosition, double bpm)
+{
+    if (bpm <= 0.0)
+        return;
+
+    ppqPosition = std::max(0.0, ppqPosition);
+
+    auto it = std::lower_bound(changes.begin(), changes.end(), ppqPosition,
+                               [](const Change& change, double ppq) { return change.ppq < ppq; });
+
+    if (it != changes.end() && it->ppq == ppqPosition)
+        it->bpm = bpm;
+    else
+        changes.insert(it, { ppqPosition, bpm, 0.0 });
+
+    updateStartTimes();
+}
+
+void TempoMap::updateStartTimes()
+{
+    changes[0].startTime = 0.0;
+
+    for (size_t i = 1; i < changes.size(); ++i)
+    {
+        const auto& previous = changes[i - 1];
+        changes[i].startTime = previous.startTime + (changes[i].ppq - previous.ppq) * 60.0 / previous.bpm;
+    }
+}
+
+const TempoMap::Change& TempoMap::findSegmentAtTime(double seconds) const
+{
+    auto it = std::upper_bound(changes.begin(), changes.end(), seconds,
+                               [](double time, const Change& change) { return time < change.startTime; });
+
+    return it == changes.begin() ? changes.front() : *(it - 1);
+}
+
+double TempoMap::getTempoAtTime(double seconds) const
+{
+    return findSegmentAtTime(seconds).bpm;
+}
+
+double TempoMap::getPpqAtTime(double seconds) const
+{
+    const auto& segment = findSegmentAtTime(seconds);
+    return segment.ppq + (seconds - segment.startTime) * segment.bpm / 60.0;
+}
+
+double TempoMap::getTimeAtPpq(double ppqPosition) const
+{
+    auto it = std::upper_bound(changes.begin(), changes.end(), ppqPosition,
+                               [](double ppq, const Change& change) { return ppq < change.ppq; });
+
+    const auto& segment = it == changes.begin() ? changes.front() : *(it - 1);
+    return segment.startTime + (ppqPosition - segment.ppq) * 60.0 / segment.bpm;
+}
+
+double TempoMap::getNextChangeTimeAfter(double seconds) const
+{
+    auto it = std::upper_bound(changes.begin(), changes.end(), seconds,
+                               [](double time, const Change& change) { return time < change.startTime; });
+
+    return it == changes.end() ? std::numeric_limits<double>::infinity() : it->startTime;
+}
+
+bool TempoMap::parseCsv(std::istream& input, TempoMap& result, std::string& errorMessage)
+{
+    std::vector<std::pair<double, double>> rows;
+    std::string line;
+    int lineNumber = 0;
+    bool skippedHeader = false;
+
+    auto parseNumber = [](const std::string& text, double& value) {
+        const char* begin = text.c_str();
+        char* end = nullptr;
+        value = std::strtod(begin, &end);
+
+        if (end == begin)
+            return false;
+
+        while (*end == ' ' || *end == '\t' || *end == '\r')
+            ++end;
+
+        return *end == '\0';
+    };
+
+    while (std::getline(input, line))
+    {
+        ++lineNumber;
+
+        const auto firstChar = line.find_first_not_of(" \t\r");
+        if (firstChar == std::string::npos || line[firstChar] == '#')
+            continue;
+
+        const auto comma = line.find(',');
+        double ppq = 0.0, bpm = 0.0;
+
+        if (comma == std::string::npos
+            || !parseNumber(line.substr(0, comma), ppq)
+            || !parseNumber(line.substr(comma + 1), bpm))
+        {
+            // Allow a single header row such as "beat,bpm" before the data
+            if (rows.empty() && !skippedHeader)
+            {
+                skippedHeader = true;
+                continue;
+            }
+
+            errorMessage = "line " + std::to_string(lineNumber) + ": expected \"beat,bpm\"";
+            return false;
+        }
+
+        if (ppq < 0.0 || bpm <= 0.0)
+        {
+            errorMessage = "line " + std::to_string(lineNumber) + ": beat must be >= 0 and bpm > 0";
+            return false;
+        }
+
+        rows.emplace_back(ppq, bpm);
+    }
+
+    if (rows.empty())
+    {
+        errorMessage = "no tempo rows found";
+        return false;
+    }
+
+    // The earliest tempo also applies before its row
+    std::stable_sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    TempoMap map(rows.front().second);
+    for (const auto& [ppq, bpm] : rows)
+        map.addChange(ppq, bpm);
+
+    result = map;
+    return true;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+// TempoMap
+// - Piecewise-constant tempo over quarter-note (PPQ) positions, for driving the engine
+//   the way a host transport would (offline rendering, non-JUCE hosts)
+// - Converts between seconds and PPQ position across tempo changes
+// - parseCsv() reads "beat,bpm" rows (beat = quarter notes from the start); blank lines,
+//   '#' comments and a non-numeric header row are ignored
+// - JUCE-free (part of Pulse24SyncCore)
+
+#include <istream>
+#include <string>
+#include <vector>
+
+class TempoMap
+{
+public:
+    explicit TempoMap(double constantBPM = 120.0);
+
+    // Adds or replaces the tempo from ppqPosition onwards. Non-positive tempos are ignored.
+    void addChange(double ppqPosition, double bpm);
+
+    double getTempoAtTime(double seconds) const;
+    double getPpqAtTime(double seconds) const;
+    double getTimeAtPpq(double ppqPosition) const;
+
+    // Start time of the first tempo change after seconds, or infinity if there is none
+    double getNextChangeTimeAfter(double seconds) const;
+
+    int getNumChanges() const { return static_cast<int>(changes.size()); }
+
+    // Returns false and fills errorMessage on malformed input; result is untouched then
+    static bool parseCsv(std::istream& input, TempoMap& result, std::string& errorMessage);
+
+private:
+    struct Change
+    {
+        double ppq;         // Position where this tempo starts
+        double bpm;
+        double startTime;   // Seconds at ppq (derived)
+    };
+
+    std::vector<Change> changes; // Sorted by ppq; changes[0].ppq == 0
+
+    const Change& findSegmentAtTime(double seconds) const;
+    void updateStartTimes();
+};
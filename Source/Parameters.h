@@ -14,4 +14,15 @@ namespace PluginParams {
     inline constexpr const char* name_pulseWidth    = "Pulse Width";
     inline constexpr const char* name_syncToHost    = "Sync to Host";
     inline constexpr const char* name_manualBPM     = "Manual BPM";
-}
\ No newline at end of file
+
+    // Default values (shared by the parameter layout and the state codec)
+    inline constexpr bool  default_enabled       = true;
+    inline constexpr float default_pulseVelocity = 100.0f;
+    inline constexpr float default_pulseWidth    = 22.0f;
+    inline constexpr bool  default_syncToHost    = true;
+    inline constexpr float default_manualBPM     = 120.0f;
+
+    // Pulse width range in milliseconds
+    inline constexpr float min_pulseWidth = 1.0f;
+    inline constexpr float max_pulseWidth = 50.0f;
+}
@@ -5,16 +5,15 @@
 Pulse24SyncAudioProcessorEditor::Pulse24SyncAudioProcessorEditor(Pulse24SyncAudioProcessor& p)
     : AudioProcessorEditor(&p), audioProcessor(p)
 {
-    setSize(400, 500);
+    setSize(400, 540);
     setupUI();
-
-    // Start timer for status updates
-    startTimerHz(10); // Update 10 times per second
+    updateStatus();
 }
 
 Pulse24SyncAudioProcessorEditor::~Pulse24SyncAudioProcessorEditor()
 {
     stopTimer();
+    vBlankAttachment.reset();
 }
 
 void Pulse24SyncAudioProcessorEditor::paint(juce::Graphics& g)
@@ -41,6 +40,10 @@ void Pulse24SyncAudioProcessorEditor::resized()
     statusLabel.setBounds(bounds.removeFromTop(30));
     bounds.removeFromTop(10);
 
+    // Beat/tick indicator
+    pulseIndicator.setBounds(bounds.removeFromTop(20));
+    bounds.removeFromTop(10);
+
     // Enabled button
     enabledButton.setBounds(bounds.removeFromTop(30));
     bounds.removeFromTop(10);
@@ -85,6 +88,9 @@ void Pulse24SyncAudioProcessorEditor::setupUI()
     addAndMakeVisible(statusLabel);
     styleLabel(statusLabel, "Status: Ready", juce::Colours::lightgreen);
 
+    // Beat/tick indicator
+    addAndMakeVisible(pulseIndicator);
+
     // Enabled button
     addAndMakeVisible(enabledButton);
     enabledButton.setButtonText("Enabled");
@@ -126,36 +132,112 @@ void Pulse24SyncAudioProcessorEditor::setupUI()
     manualBPMSlider.setTextBoxStyle(juce::Slider::TextBoxRight, false, 60, 20);
     manualBPMAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.parameters, PluginParams::manualBPM, manualBPMSlider);
+
+    // Status depends on these; attachments deliver host/automation changes here on the message thread
+    enabledButton.onClick = [this] { updateStatus(); };
+    syncToHostButton.onClick = [this] { updateStatus(); };
+    manualBPMSlider.onValueChange = [this] { updateStatus(); };
+}
+
+void Pulse24SyncAudioProcessorEditor::visibilityChanged()
+{
+    refreshFromDisplayState();
+    updateRefreshSource();
+}
+
+void Pulse24SyncAudioProcessorEditor::parentHierarchyChanged()
+{
+    refreshFromDisplayState();
+    updateRefreshSource();
+}
+
+void Pulse24SyncAudioProcessorEditor::vBlankCallback()
+{
+    refreshFromDisplayState();
+
+    // Stopped: hand over to the idle timer, which removes this attachment (it cannot
+    // safely delete itself from inside its own callback)
+    if (!audioProcessor.displayState.running.load() && !isTimerRunning())
+        startTimerHz(idlePollHz);
 }
 
 void Pulse24SyncAudioProcessorEditor::timerCallback()
 {
+    refreshFromDisplayState();
+    updateRefreshSource();
+}
+
+void Pulse24SyncAudioProcessorEditor::updateRefreshSource()
+{
+    const bool showing = isShowing();
+
+    if (showing && audioProcessor.displayState.running.load())
+    {
+        stopTimer();
+
+        if (vBlankAttachment == nullptr)
+            vBlankAttachment = std::make_unique<juce::VBlankAttachment>(this, [this] { vBlankCallback(); });
+    }
+    else
+    {
+        vBlankAttachment.reset();
+
+        if (!showing)
+            stopTimer();
+        else if (!isTimerRunning())
+            startTimerHz(idlePollHz);
+    }
+}
+
+void Pulse24SyncAudioProcessorEditor::refreshFromDisplayState()
+{
+    // Minimised windows may still receive vblanks; nothing to draw then
+    if (!isShowing())
+        return;
+
+    const auto& state = audioProcessor.displayState;
+
+    pulseIndicator.setState(state.pulseIndex.load(std::memory_order_relaxed),
+                            juce::roundToInt(state.pulsesPerQuarterNote.load(std::memory_order_relaxed)),
+                            state.running.load(std::memory_order_relaxed));
     updateStatus();
 }
 
 void Pulse24SyncAudioProcessorEditor::updateStatus()
 {
-    auto& pulseGen = audioProcessor.pulseGenerator;
+    const auto& state = audioProcessor.displayState;
+
+    StatusKey key;
+    key.enabled = enabledButton.getToggleState();
+    key.syncToHost = syncToHostButton.getToggleState();
+    key.bpmTenths = juce::roundToInt((key.syncToHost ? state.bpm.load() : manualBPMSlider.getValue()) * 10.0);
+    key.ppqn = juce::roundToInt(state.pulsesPerQuarterNote.load());
+
+    if (key == lastStatusKey)
+        return;
+
+    lastStatusKey = key;
 
+    const double bpm = key.bpmTenths / 10.0;
     juce::String statusText = "Status: ";
 
-    if (!pulseGen.getEnabled())
+    if (!key.enabled)
     {
         statusText += "Disabled";
         statusLabel.setColour(juce::Label::textColourId, juce::Colours::grey);
     }
-    else if (!pulseGen.getSyncToHost())
+    else if (!key.syncToHost)
     {
-        statusText += "Manual Mode - " + juce::String(pulseGen.getManualBPM(), 1) + " BPM";
+        statusText += "Manual Mode - " + juce::String(bpm, 1) + " BPM";
         statusLabel.setColour(juce::Label::textColourId, juce::Colours::orange);
     }
     else
     {
-        statusText += "Host Sync - " + juce::String(pulseGen.getCurrentBPM(), 1) + " BPM";
+        statusText += "Host Sync - " + juce::String(bpm, 1) + " BPM";
         statusLabel.setColour(juce::Label::textColourId, juce::Colours::lightgreen);
     }
 
-    statusText += " | Rate: " + juce::String(pulseGen.getPulseRate(), 1) + " Hz";
+    statusText += " | Rate: " + juce::String(bpm / 60.0 * key.ppqn, 1) + " Hz";
 
     statusLabel.setText(statusText, juce::dontSendNotification);
 }
@@ -2,14 +2,20 @@
 
 // Pulse24SyncAudioProcessorEditor
 // - Minimal UI that binds controls to parameters (see Parameters.h)
-// - Displays a status line (enabled, sync mode, BPM, pulse rate)
-// - Uses a timer to periodically pull state from the engine for UX feedback
+// - Displays a status line (enabled, sync mode, BPM, pulse rate) and a beat/tick indicator
+// - Controls' callbacks refresh the status. While the editor is showing, the
+//   processor's DisplayState is read on the message thread: once per display refresh
+//   (VBlankAttachment) while the engine runs, and by a low-rate timer that only
+//   watches for a start while it is stopped. Only what changed is repainted.
+//   A hidden editor does no work, and the audio thread never posts messages.
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "Parameters.h"
+#include "PulseIndicator.h"
 
-class Pulse24SyncAudioProcessorEditor : public juce::AudioProcessorEditor, public juce::Timer
+class Pulse24SyncAudioProcessorEditor : public juce::AudioProcessorEditor,
+                                        private juce::Timer
 {
 public:
     Pulse24SyncAudioProcessorEditor(Pulse24SyncAudioProcessor&);
@@ -17,7 +23,8 @@ public:
 
     void paint(juce::Graphics&) override;
     void resized() override;
-    void timerCallback() override; // Periodically updates status label from engine state
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
 
 private:
     Pulse24SyncAudioProcessor& audioProcessor;
@@ -37,6 +44,29 @@ private:
     juce::Label manualBPMLabel;
     juce::Label titleLabel;
     juce::Label statusLabel;
+    PulseIndicator pulseIndicator;
+
+    // Attached only while running and showing (see updateRefreshSource)
+    std::unique_ptr<juce::VBlankAttachment> vBlankAttachment;
+    static constexpr int idlePollHz = 10; // Stopped: how often the timer checks for a start
+
+    // Inputs the status text was last built from; rebuilt only when one changes
+    struct StatusKey
+    {
+        bool enabled = false;
+        bool syncToHost = false;
+        int bpmTenths = -1;
+        int ppqn = -1;
+
+        bool operator==(const StatusKey& other) const
+        {
+            return enabled == other.enabled && syncToHost == other.syncToHost
+                && bpmTenths == other.bpmTenths && ppqn == other.ppqn;
+        }
+        bool operator!=(const StatusKey& other) const { return !(*this == other); }
+    };
+
+    StatusKey lastStatusKey;
 
     // Parameter attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> enabledAttachment;
@@ -46,7 +76,11 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> manualBPMAttachment;
 
     void setupUI();   // Creates and binds UI controls to parameters
-    void updateStatus(); // Renders a concise status line for users
+    void updateStatus(); // Renders a concise status line for users (only if its inputs changed)
+    void refreshFromDisplayState(); // Pulls DisplayState into the indicator and status
+    void updateRefreshSource();     // Vblank while running, idle timer while stopped, nothing while hidden
+    void vBlankCallback();          // Running: refresh; on a stop, start the idle timer
+    void timerCallback() override;  // Stopped: refresh and switch to vblank once running
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Pulse24SyncAudioProcessorEditor)
 };
@@ -8,17 +8,25 @@ Pulse24SyncAudioProcessor::Pulse24SyncAudioProcessor()
         .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
     parameters(*this, nullptr, juce::Identifier("Pulse24Sync"),
         {
-            std::make_unique<juce::AudioParameterBool>(PluginParams::enabled, PluginParams::name_enabled, true),
-            std::make_unique<juce::AudioParameterFloat>(PluginParams::pulseVelocity, PluginParams::name_pulseVelocity, 0.0f, 127.0f, 100.0f),
-            std::make_unique<juce::AudioParameterFloat>(PluginParams::pulseWidth, PluginParams::name_pulseWidth, 1.0f, 50.0f, 22.0f),
-            std::make_unique<juce::AudioParameterBool>(PluginParams::syncToHost, PluginParams::name_syncToHost, true),
-            std::make_unique<juce::AudioParameterFloat>(PluginParams::manualBPM, PluginParams::name_manualBPM, 60.0f, 200.0f, 120.0f)
+            std::make_unique<juce::AudioParameterBool>(PluginParams::enabled, PluginParams::name_enabled, PluginParams::default_enabled),
+            std::make_unique<juce::AudioParameterFloat>(PluginParams::pulseVelocity, PluginParams::name_pulseVelocity, 0.0f, 127.0f, PluginParams::default_pulseVelocity),
+            std::make_unique<juce::AudioParameterFloat>(PluginParams::pulseWidth, PluginParams::name_pulseWidth, PluginParams::min_pulseWidth, PluginParams::max_pulseWidth, PluginParams::default_pulseWidth),
+            std::make_unique<juce::AudioParameterBool>(PluginParams::syncToHost, PluginParams::name_syncToHost, PluginParams::default_syncToHost),
+            std::make_unique<juce::AudioParameterFloat>(PluginParams::manualBPM, PluginParams::name_manualBPM, 60.0f, 200.0f, PluginParams::default_manualBPM)
         })
 {
+    enabledParam       = parameters.getRawParameterValue(PluginParams::enabled);
+    pulseVelocityParam = parameters.getRawParameterValue(PluginParams::pulseVelocity);
+    pulseWidthParam    = parameters.getRawParameterValue(PluginParams::pulseWidth);
+    syncToHostParam    = parameters.getRawParameterValue(PluginParams::syncToHost);
+    manualBPMParam     = parameters.getRawParameterValue(PluginParams::manualBPM);
+
+    startTimerHz(tablePollHz);
 }
 
 Pulse24SyncAudioProcessor::~Pulse24SyncAudioProcessor()
 {
+    stopTimer();
 }
 
 const juce::String Pulse24SyncAudioProcessor::getName() const
@@ -43,33 +51,48 @@ bool Pulse24SyncAudioProcessor::isMidiEffect() const
 
 double Pulse24SyncAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // A pulse still sounding when the transport stops decays for up to its full width
+    return static_cast<double>(PluginParams::max_pulseWidth) * 0.001;
 }
 
 int Pulse24SyncAudioProcessor::getNumPrograms()
 {
-    return 1;
+    return presetBank.size();
 }
 
 int Pulse24SyncAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return presetBank.getCurrentIndex();
 }
 
 void Pulse24SyncAudioProcessor::setCurrentProgram(int index)
 {
-    juce::ignoreUnused(index);
+    if (!juce::isPositiveAndBelow(index, presetBank.size()))
+        return;
+
+    // Keep parameters (host/UI view) in step with the preset, then hand the
+    // pre-built preset to the audio thread in one pointer swap. Enabled is not
+    // part of a preset and stays as the user left it.
+    auto values = presetBank.get(index).values;
+    values.enabled = enabledParam->load() >= 0.5f;
+
+    presetSwitchSequence.fetch_add(1);
+    applyStateValues(values);
+    presetBank.select(index);
+    presetSwitchSequence.fetch_add(1);
 }
 
 const juce::String Pulse24SyncAudioProcessor::getProgramName(int index)
 {
-    juce::ignoreUnused(index);
-    return {};
+    if (!juce::isPositiveAndBelow(index, presetBank.size()))
+        return {};
+
+    return presetBank.get(index).name;
 }
 
 void Pulse24SyncAudioProcessor::changeProgramName(int index, const juce::String& newName)
 {
-    juce::ignoreUnused(index, newName);
+    presetBank.rename(index, newName);
 }
 
 void Pulse24SyncAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -79,8 +102,18 @@ void Pulse24SyncAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     // Initialize pulse generator
     pulseGenerator.prepare(sampleRate);
 
+    // Fetch preset tables for this sample rate (audio is stopped here)
+    presetBank.prepare(sampleRate);
+
     // Set initial parameters
     syncParametersToEngine();
+
+    // Audio is stopped, so tables retired earlier can go and the new one is handed over directly
+    heldTable = pulseTableCache->getOrBuild(sampleRate, pulseGenerator.getPulseDurationSamples());
+    retiredTables.clear();
+    readyTable.store(&heldTable->table);
+    tableInUse.store(&heldTable->table);
+    pulseGenerator.setPulseTable(&heldTable->table);
 }
 
 void Pulse24SyncAudioProcessor::releaseResources()
@@ -94,19 +127,127 @@ bool Pulse24SyncAudioProcessor::isBusesLayoutSupported(const BusesLayout& busesL
     return true;
 }
 
+bool Pulse24SyncAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
 void Pulse24SyncAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processBlockImpl(buffer, midiMessages);
+}
+
+void Pulse24SyncAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processBlockImpl(buffer, midiMessages);
+}
+
+template <typename SampleType>
+void Pulse24SyncAudioProcessor::processBlockImpl(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
-    auto totalNumInputChannels = getTotalNumInputChannels();
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
 
-    // Clear the output buffer first (we want to generate audio, not pass through input)
+    // Clear MIDI messages as we're not using them anymore
+    midiMessages.clear();
+
+    // Get host tempo information
+    updateHostState();
+
+    // Apply a newly selected program as one consistent set of values
+    if (auto* preset = presetBank.takePending())
+    {
+        auto values = preset->values;
+        values.enabled = enabledParam->load() >= 0.5f; // Programs never switch the clock on or off
+        applyValuesToEngine(values);
+        pulseGenerator.setPulseTable(preset->pulseTable);
+    }
+
+    // Clear the output buffer first (we want to generate audio, not pass through input).
+    // This has to happen on every block, idle ones included: with a stereo input bus
+    // the host's input arrives in this same buffer, and the plugin wrappers wrap fresh
+    // host memory each callback, so a buffer cleared once does not stay silent. JUCE
+    // 7 has no API to raise the VST3/AU output-silence flags, so silence is not
+    // reported to the host either; the idle saving is skipping the engine below.
     buffer.clear();
 
+    // Idle fast path: once stopped/disabled and the last pulse tail has finished,
+    // skip parameter sync and the engine entirely
+    const bool enabled = enabledParam->load() >= 0.5f;
+    const bool running = enabled && pulseGenerator.getHostIsPlaying();
+    if (!running && !pulseGenerator.isPulseActive())
+    {
+        publishDisplayState(false);
+        return;
+    }
+
     // Update pulse generator parameters
+    pulseGenerator.setSampleRate(getSampleRate());
     syncParametersToEngine();
+    updatePulseTable();
 
-    // Get host tempo information
+    // Process pulses and generate audio
+    pulseGenerator.process(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), buffer.getNumSamples());
+
+    publishDisplayState(running);
+}
+
+void Pulse24SyncAudioProcessor::publishDisplayState(bool running)
+{
+    displayState.pulseIndex.store(pulseGenerator.getPulseIndex(), std::memory_order_relaxed);
+    displayState.pulsesPerQuarterNote.store(pulseGenerator.getPulsesPerQuarterNote(), std::memory_order_relaxed);
+    displayState.bpm.store(pulseGenerator.getCurrentBPM(), std::memory_order_relaxed);
+    displayState.running.store(running, std::memory_order_relaxed); // Editors poll for start/stop on the message thread
+}
+
+void Pulse24SyncAudioProcessor::updatePulseTable()
+{
+    if (pulseGenerator.hasMatchingPulseTable())
+        return;
+
+    const auto durationSamples = pulseGenerator.getPulseDurationSamples();
+
+    // Announce the table before using it; timerCallback() never frees the announced
+    // one, and re-reading readyTable afterwards catches a swap in between
+    auto* table = readyTable.load();
+    tableInUse.store(table);
+
+    if (table != nullptr && readyTable.load() == table && table->matches(getSampleRate(), durationSamples))
+    {
+        pulseGenerator.setPulseTable(table);
+        return;
+    }
+
+    // Not built yet: the engine evaluates the pulse directly until the message thread
+    // sees the request (a width sweep only ever leaves the latest one)
+    pulseGenerator.setPulseTable(nullptr);
+    requestedTableDuration.store(durationSamples);
+}
+
+void Pulse24SyncAudioProcessor::timerCallback()
+{
+    // Builds only while the request differs from the held table; otherwise just tidies up
+    const auto durationSamples = requestedTableDuration.load();
+
+    if (durationSamples > 0 && (heldTable == nullptr || !heldTable->table.matches(getSampleRate(), durationSamples)))
+    {
+        if (heldTable != nullptr)
+            retiredTables.add(heldTable);
+
+        heldTable = pulseTableCache->getOrBuild(getSampleRate(), durationSamples);
+        readyTable.store(&heldTable->table);
+    }
+
+    // Let go of retired tables the audio thread no longer announces; the cache frees
+    // a table once no instance holds it
+    const auto* inUse = tableInUse.load();
+
+    for (int i = retiredTables.size(); --i >= 0;)
+        if (&retiredTables.getObjectPointerUnchecked(i)->table != inUse)
+            retiredTables.remove(i);
+}
+
+void Pulse24SyncAudioProcessor::updateHostState()
+{
     juce::AudioPlayHead* playHead = getPlayHead();
     if (playHead != nullptr)
     {
@@ -123,33 +264,20 @@ void Pulse24SyncAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
             // Get time position
             pulseGenerator.setHostPosition(posInfo->getTimeInSeconds().orFallback(0.0));
             
-            // Get PPQ position for accurate sync
-            double ppqPosition = posInfo->getPpqPosition().orFallback(0.0);
-            pulseGenerator.setHostPPQPosition(ppqPosition);
+            // Get PPQ position for accurate sync (hosts without one leave the engine free-running)
+            if (auto ppqPosition = posInfo->getPpqPosition())
+                pulseGenerator.setHostPPQPosition(*ppqPosition);
+            else
+                pulseGenerator.clearHostPPQPosition();
+            return;
         }
-        else
-        {
-            // Fallback if position info not available
-            pulseGenerator.setHostTempo(120.0);
-            pulseGenerator.setHostIsPlaying(false);
-            pulseGenerator.setHostPosition(0.0);
-            pulseGenerator.setHostPPQPosition(0.0);
-        }
-    }
-    else
-    {
-        // Fallback if playhead not available
-        pulseGenerator.setHostTempo(120.0);
-        pulseGenerator.setHostIsPlaying(false);
-        pulseGenerator.setHostPosition(0.0);
-        pulseGenerator.setHostPPQPosition(0.0);
     }
 
-    // Process pulses and generate audio
-    pulseGenerator.process(buffer.getNumSamples(), getSampleRate(), buffer);
-    
-    // Clear MIDI messages as we're not using them anymore
-    midiMessages.clear();
+    // Fallback if playhead or position info not available
+    pulseGenerator.setHostTempo(120.0);
+    pulseGenerator.setHostIsPlaying(false);
+    pulseGenerator.setHostPosition(0.0);
+    pulseGenerator.clearHostPPQPosition();
 }
 
 bool Pulse24SyncAudioProcessor::hasEditor() const
@@ -164,27 +292,74 @@ juce::AudioProcessorEditor* Pulse24SyncAudioProcessor::createEditor()
 
 void Pulse24SyncAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = parameters.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    PluginState::write(getStateValues(), destData);
 }
 
 void Pulse24SyncAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    PluginState::Values values;
+
+    if (PluginState::read(data, sizeInBytes, values))
+    {
+        applyStateValues(values);
+        presetBank.restore(values.program);
+        return;
+    }
+
+    // Fall back to the XML state written by earlier releases
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
-    if (xmlState.get() != nullptr)
-        if (xmlState->hasTagName(parameters.state.getType()))
-            parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+    if (xmlState.get() != nullptr && PluginState::readXml(*xmlState, values))
+        applyStateValues(values);
+}
+
+PluginState::Values Pulse24SyncAudioProcessor::getStateValues() const
+{
+    PluginState::Values values;
+    values.enabled       = enabledParam->load() >= 0.5f;
+    values.pulseVelocity = pulseVelocityParam->load();
+    values.pulseWidth    = pulseWidthParam->load();
+    values.syncToHost    = syncToHostParam->load() >= 0.5f;
+    values.manualBPM     = manualBPMParam->load();
+    values.program       = presetBank.getCurrentIndex();
+    return values;
+}
+
+void Pulse24SyncAudioProcessor::applyStateValues(const PluginState::Values& values)
+{
+    auto setParameter = [this](const char* id, float value) {
+        if (auto* param = parameters.getParameter(id))
+            param->setValueNotifyingHost(param->convertTo0to1(value));
+    };
+
+    setParameter(PluginParams::enabled,       values.enabled ? 1.0f : 0.0f);
+    setParameter(PluginParams::pulseVelocity, values.pulseVelocity);
+    setParameter(PluginParams::pulseWidth,    values.pulseWidth);
+    setParameter(PluginParams::syncToHost,    values.syncToHost ? 1.0f : 0.0f);
+    setParameter(PluginParams::manualBPM,     values.manualBPM);
 }
 
 void Pulse24SyncAudioProcessor::syncParametersToEngine()
 {
-    pulseGenerator.setEnabled(*parameters.getRawParameterValue(PluginParams::enabled));
-    pulseGenerator.setPulseVelocity(*parameters.getRawParameterValue(PluginParams::pulseVelocity));
-    pulseGenerator.setPulseWidth(*parameters.getRawParameterValue(PluginParams::pulseWidth));
-    pulseGenerator.setSyncToHost(*parameters.getRawParameterValue(PluginParams::syncToHost));
-    pulseGenerator.setManualBPM(*parameters.getRawParameterValue(PluginParams::manualBPM));
+    // Skip the block if a program switch is writing parameters; the engine keeps
+    // its previous (consistent) settings and picks up the new preset next block
+    const auto sequence = presetSwitchSequence.load(std::memory_order_acquire);
+    if ((sequence & 1) != 0)
+        return;
+
+    const auto values = getStateValues();
+
+    if (presetSwitchSequence.load(std::memory_order_acquire) == sequence)
+        applyValuesToEngine(values);
+}
+
+void Pulse24SyncAudioProcessor::applyValuesToEngine(const PluginState::Values& values)
+{
+    pulseGenerator.setEnabled(values.enabled);
+    pulseGenerator.setPulseVelocity(values.pulseVelocity);
+    pulseGenerator.setPulseWidth(values.pulseWidth);
+    pulseGenerator.setSyncToHost(values.syncToHost);
+    pulseGenerator.setManualBPM(values.manualBPM);
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
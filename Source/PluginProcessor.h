@@ -5,12 +5,25 @@
 // - Bridges host state (tempo/transport) to the PulseGenerator engine
 // - Generates an audible 1kHz pulse train at 24 PPQN for sync testing
 // - UI binds directly to parameters; processBlock reads and applies every block
+// - Programs come from PresetBank; switching publishes a pre-built preset that the
+//   audio thread applies atomically at the next block boundary
+// - Pulse tables come from the process-wide, reference-counted PulseTableCache. The
+//   message thread holds them and publishes a raw pointer; the audio thread announces
+//   the table it uses so the message thread only drops tables it has stopped using.
+//   The message thread polls for table requests, so the audio thread posts no messages
+// - When stopped/disabled and no pulse tail is sounding, processBlock takes an idle
+//   fast path that skips parameter sync and the engine and leaves a cleared buffer
+// - Publishes a small lock-free DisplayState for the editor at the end of each block
 
 #include <JuceHeader.h>
 #include "PulseGenerator.h"
 #include "Parameters.h"
+#include "PluginState.h"
+#include "PresetBank.h"
+#include "PulseTableCache.h"
 
-class Pulse24SyncAudioProcessor : public juce::AudioProcessor
+class Pulse24SyncAudioProcessor : public juce::AudioProcessor,
+                                  private juce::Timer
 {
 public:
     Pulse24SyncAudioProcessor();
@@ -22,6 +35,8 @@ public:
     bool isBusesLayoutSupported(const BusesLayout& busesLayout) const override;
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
@@ -48,7 +63,53 @@ public:
     // Pulse generator
     PulseGenerator pulseGenerator;
 
+    // Program bank (clock configurations)
+    PresetBank presetBank;
+
+    // Engine state for the editor, written at the end of every block (lock-free reads)
+    struct DisplayState
+    {
+        std::atomic<std::int64_t> pulseIndex { -1 };      // See PulseGenerator::getPulseIndex()
+        std::atomic<double> pulsesPerQuarterNote { 24.0 };
+        std::atomic<double> bpm { 120.0 };                // Tempo in use (host or manual)
+        std::atomic<bool> running { false };              // Enabled and transport playing
+    };
+
+    DisplayState displayState;
+
 private:
     void syncParametersToEngine();
+    void updateHostState(); // Pulls tempo/transport from the playhead into the engine
+    void publishDisplayState(bool running); // Updates displayState for the editor
+    PluginState::Values getStateValues() const;
+    void applyStateValues(const PluginState::Values& values); // Sets parameters, notifying the host
+    void applyValuesToEngine(const PluginState::Values& values);
+
+    // Odd while setCurrentProgram() is writing a preset's parameters; lets the audio
+    // thread skip (rather than half-apply) parameter reads during a switch
+    std::atomic<juce::uint32> presetSwitchSequence { 0 };
+
+    // Shared pulse tables (see PulseTableCache.h)
+    juce::SharedResourcePointer<PulseTableCache> pulseTableCache;
+    PulseTableCache::TablePtr heldTable;                                // Message thread: table behind readyTable
+    juce::ReferenceCountedArray<PulseTableCache::SharedTable> retiredTables; // Message thread: replaced, maybe still in use
+    std::atomic<const PulseTable*> readyTable { nullptr };             // Latest table for the audio thread to pick up
+    std::atomic<const PulseTable*> tableInUse { nullptr };             // Announced by the audio thread before use
+    std::atomic<int> requestedTableDuration { 0 }; // Pulse length (samples) to build on the message thread
+    static constexpr int tablePollHz = 10;         // How often the message thread checks for requests
+    void updatePulseTable();                       // Audio thread: picks up readyTable or requests a build
+    void timerCallback() override;                 // Message thread: builds the requested table, drops unused ones
+
+    // Shared body of the float and double processBlock overloads
+    template <typename SampleType>
+    void processBlockImpl(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
+
+    // Cached raw parameter values (looked up once instead of by ID every block)
+    std::atomic<float>* enabledParam = nullptr;
+    std::atomic<float>* pulseVelocityParam = nullptr;
+    std::atomic<float>* pulseWidthParam = nullptr;
+    std::atomic<float>* syncToHostParam = nullptr;
+    std::atomic<float>* manualBPMParam = nullptr;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Pulse24SyncAudioProcessor)
 };
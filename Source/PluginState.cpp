@@ -0,0 +1,107 @@
+#include "PluginState.h"
+
+namespace PluginState
+{
+namespace
+{
+    constexpr char magic[4] = { 'P', '2', '4', 'S' };
+    constexpr int headerSize = 4 + 2 + 2;
+    constexpr int maxFields = 64;
+
+    // Number of float fields written by each schema version (index = version)
+    constexpr int fieldCountForVersion[] = { 0, 5, 6 };
+
+    static_assert(sizeof(fieldCountForVersion) / sizeof(fieldCountForVersion[0]) == currentVersion + 1,
+                  "Add the field count for every schema version");
+
+    // Upgrades values decoded with an older schema to the current meaning of each field.
+    // Fields appended in later versions keep their defaults automatically.
+    // e.g. for a future v2 that changes a unit: if (fromVersion < 2) values.x = convert(values.x);
+    void migrate(Values& values, int fromVersion)
+    {
+        juce::ignoreUnused(values, fromVersion); // v2 only appended the program index (defaults to 0)
+    }
+}
+
+void write(const Values& values, juce::MemoryBlock& destData)
+{
+    const float fields[] = {
+        values.enabled ? 1.0f : 0.0f,
+        values.pulseVelocity,
+        values.pulseWidth,
+        values.syncToHost ? 1.0f : 0.0f,
+        values.manualBPM,
+        static_cast<float>(values.program)
+    };
+
+    constexpr int numFields = static_cast<int>(sizeof(fields) / sizeof(fields[0]));
+    static_assert(numFields == fieldCountForVersion[currentVersion], "Field list and schema version out of sync");
+
+    juce::MemoryOutputStream out(destData, false);
+    out.write(magic, sizeof(magic));
+    out.writeShort(static_cast<short>(currentVersion));
+    out.writeShort(static_cast<short>(numFields));
+
+    for (auto field : fields)
+        out.writeFloat(field);
+}
+
+bool read(const void* data, int sizeInBytes, Values& values)
+{
+    if (data == nullptr || sizeInBytes < headerSize || std::memcmp(data, magic, sizeof(magic)) != 0)
+        return false;
+
+    juce::MemoryInputStream in(data, static_cast<size_t>(sizeInBytes), false);
+    in.skipNextBytes(sizeof(magic));
+
+    const int version = static_cast<juce::uint16>(in.readShort());
+    const int numFields = static_cast<juce::uint16>(in.readShort());
+
+    if (version < 1 || version > currentVersion
+        || numFields > maxFields
+        || sizeInBytes < headerSize + numFields * static_cast<int>(sizeof(float)))
+        return false;
+
+    float fields[maxFields];
+    for (int i = 0; i < numFields; ++i)
+        fields[i] = in.readFloat();
+
+    Values decoded;
+    const int available = juce::jmin(numFields, fieldCountForVersion[currentVersion]);
+    auto field = [&](int index, float fallback) { return index < available ? fields[index] : fallback; };
+
+    decoded.enabled       = field(0, decoded.enabled ? 1.0f : 0.0f) >= 0.5f;
+    decoded.pulseVelocity = field(1, decoded.pulseVelocity);
+    decoded.pulseWidth    = field(2, decoded.pulseWidth);
+    decoded.syncToHost    = field(3, decoded.syncToHost ? 1.0f : 0.0f) >= 0.5f;
+    decoded.manualBPM     = field(4, decoded.manualBPM);
+    decoded.program       = juce::jmax(0, juce::roundToInt(field(5, static_cast<float>(decoded.program))));
+
+    migrate(decoded, version);
+    values = decoded;
+    return true;
+}
+
+bool readXml(const juce::XmlElement& xml, Values& values)
+{
+    if (!xml.hasTagName("Pulse24Sync"))
+        return false;
+
+    Values decoded;
+
+    for (auto* param : xml.getChildWithTagNameIterator("PARAM"))
+    {
+        const auto id = param->getStringAttribute("id");
+        const auto value = static_cast<float>(param->getDoubleAttribute("value"));
+
+        if      (id == PluginParams::enabled)       decoded.enabled = value >= 0.5f;
+        else if (id == PluginParams::pulseVelocity) decoded.pulseVelocity = value;
+        else if (id == PluginParams::pulseWidth)    decoded.pulseWidth = value;
+        else if (id == PluginParams::syncToHost)    decoded.syncToHost = value >= 0.5f;
+        else if (id == PluginParams::manualBPM)     decoded.manualBPM = value;
+    }
+
+    values = decoded;
+    return true;
+}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+// PluginState
+// - Compact, versioned binary encoding of the plugin's parameter values
+// - Layout: "P24S" magic | uint16 schema version | uint16 field count | field count x float32
+//   (little-endian, fields in the order listed in Values)
+// - v2 appends the current program (PresetBank index) so it survives a session reload
+// - Blobs from older schema versions are migrated forward on read; newer ones are rejected
+// - readXml() decodes the APVTS XML written by releases before the binary format
+
+#include <JuceHeader.h>
+#include "Parameters.h"
+
+namespace PluginState
+{
+    // Bump when the field list or the meaning of a field changes, and add a case to migrate()
+    inline constexpr int currentVersion = 2;
+
+    struct Values
+    {
+        bool enabled        = PluginParams::default_enabled;
+        float pulseVelocity = PluginParams::default_pulseVelocity;
+        float pulseWidth    = PluginParams::default_pulseWidth;
+        bool syncToHost     = PluginParams::default_syncToHost;
+        float manualBPM     = PluginParams::default_manualBPM;
+        int program         = 0; // Current program (PresetBank index), v2+
+    };
+
+    void write(const Values& values, juce::MemoryBlock& destData);
+
+    // Returns false (leaving values untouched) if the data is not a readable binary state blob
+    bool read(const void* data, int sizeInBytes, Values& values);
+
+    // Reads parameter values from a legacy APVTS state (<Pulse24Sync><PARAM id=".." value=".."/>...)
+    bool readXml(const juce::XmlElement& xml, Values& values);
+}
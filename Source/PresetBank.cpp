@@ -0,0 +1,62 @@
+#include "PresetBank.h"
+
+PresetBank::PresetBank()
+{
+    add("Default",         PluginParams::default_pulseVelocity, PluginParams::default_pulseWidth, true,  PluginParams::default_manualBPM);
+    add("Short Click",     100.0f,  5.0f, true,   120.0f);
+    add("Long Pulse",      110.0f, 40.0f, true,   120.0f);
+    add("Quiet Host Sync",  40.0f, 22.0f, true,   120.0f);
+    add("Manual 90 BPM",   100.0f, 22.0f, false,   90.0f);
+    add("Manual 120 BPM",  100.0f, 22.0f, false,  120.0f);
+    add("Manual 140 BPM",  100.0f, 22.0f, false,  140.0f);
+
+    prepare(44100.0);
+}
+
+void PresetBank::add(const juce::String& name, float velocity, float widthMs, bool syncToHost, float manualBPM)
+{
+    auto preset = std::make_unique<Preset>();
+    preset->name = name;
+    preset->values.pulseVelocity = velocity;
+    preset->values.pulseWidth = widthMs;
+    preset->values.syncToHost = syncToHost;
+    preset->values.manualBPM = manualBPM;
+    presets.push_back(std::move(preset));
+}
+
+void PresetBank::prepare(double sampleRate)
+{
+    if (juce::exactlyEqual(sampleRate, preparedSampleRate))
+        return;
+
+    preparedSampleRate = sampleRate;
+
+    // Same ms -> samples conversion as PulseGenerator::updatePulseDuration()
+    for (auto& preset : presets)
+    {
+        const auto durationSamples = static_cast<int>(sampleRate * preset->values.pulseWidth * 0.001);
+        preset->tableRef = tableCache->getOrBuild(sampleRate, durationSamples);
+        preset->pulseTable = &preset->tableRef->table;
+    }
+}
+
+void PresetBank::rename(int index, const juce::String& newName)
+{
+    if (juce::isPositiveAndBelow(index, size()))
+        presets[static_cast<size_t>(index)]->name = newName;
+}
+
+void PresetBank::restore(int index)
+{
+    if (juce::isPositiveAndBelow(index, size()))
+        currentIndex.store(index);
+}
+
+void PresetBank::select(int index)
+{
+    if (!juce::isPositiveAndBelow(index, size()))
+        return;
+
+    currentIndex.store(index);
+    pending.store(presets[static_cast<size_t>(index)].get(), std::memory_order_release);
+}
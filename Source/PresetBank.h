@@ -0,0 +1,58 @@
+#pragma once
+
+// PresetBank
+// - Factory bank of clock configurations exposed as host programs
+// - Each preset is fully decoded (PluginState::Values) and carries its derived pulse
+//   table, fetched from the shared PulseTableCache on the message thread in prepare()
+// - Presets cover velocity, width, sync mode and manual BPM; their values.enabled and
+//   values.program are not applied (selecting a program never switches the clock on/off)
+// - select() publishes a preset with one atomic pointer store; the audio thread picks
+//   it up at the next block boundary with takePending() (no locks, no allocation)
+
+#include <JuceHeader.h>
+#include "PluginState.h"
+#include "PulseTableCache.h"
+
+class PresetBank
+{
+public:
+    struct Preset
+    {
+        juce::String name;
+        PluginState::Values values;
+        const PulseTable* pulseTable = nullptr; // Shared table for the sample rate passed to prepare()
+        PulseTableCache::TablePtr tableRef;     // Keeps pulseTable alive until the next prepare()
+    };
+
+    PresetBank();
+
+    // Message thread, audio stopped: (re)builds derived tables for a sample rate
+    void prepare(double sampleRate);
+
+    int size() const { return static_cast<int>(presets.size()); }
+    const Preset& get(int index) const { return *presets[static_cast<size_t>(index)]; }
+    void rename(int index, const juce::String& newName);
+
+    // Message thread: makes index current and queues it for the audio thread
+    void select(int index);
+    int getCurrentIndex() const { return currentIndex.load(); }
+
+    // Message thread: makes index current without queueing its values (session restore,
+    // where the saved parameter values take precedence over the preset's)
+    void restore(int index);
+    const Preset& getCurrent() const { return get(getCurrentIndex()); }
+
+    // Audio thread: returns the most recently selected preset once, otherwise nullptr
+    const Preset* takePending() noexcept { return pending.exchange(nullptr, std::memory_order_acquire); }
+
+private:
+    juce::SharedResourcePointer<PulseTableCache> tableCache;
+    std::vector<std::unique_ptr<Preset>> presets;
+    std::atomic<const Preset*> pending { nullptr };
+    std::atomic<int> currentIndex { 0 };
+    double preparedSampleRate = 0.0;
+
+    void add(const juce::String& name, float velocity, float widthMs, bool syncToHost, float manualBPM);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBank)
+};
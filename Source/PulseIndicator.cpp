@@ -0,0 +1,110 @@
+#include "PulseIndicator.h"
+
+void PulseIndicator::setState(std::int64_t newPulseIndex, int newPulsesPerQuarterNote, bool newRunning)
+{
+    newPulsesPerQuarterNote = juce::jmax(1, newPulsesPerQuarterNote);
+
+    if (newRunning != running || newPulsesPerQuarterNote != pulsesPerQuarterNote)
+    {
+        pulseIndex = newPulseIndex;
+        pulsesPerQuarterNote = newPulsesPerQuarterNote;
+        running = newRunning;
+        newTick = false;
+        repaint();
+        return;
+    }
+
+    if (newPulseIndex == pulseIndex)
+    {
+        // No pulse since the last frame: the tick LED goes out
+        if (newTick)
+        {
+            newTick = false;
+            repaint(tickLedBounds);
+        }
+
+        return;
+    }
+
+    const auto oldTick = getTickInBeat();
+    const auto oldBeatLed = isBeatLedOn();
+    const auto oldTickLed = isTickLedOn();
+
+    pulseIndex = newPulseIndex;
+    newTick = true;
+
+    const auto newTick = getTickInBeat();
+
+    if (isBeatLedOn() != oldBeatLed)
+        repaint(beatLedBounds);
+
+    if (isTickLedOn() != oldTickLed)
+        repaint(tickLedBounds);
+
+    // Repaint only the segments between the old and new tick (the whole bar when it wraps)
+    if (oldTick < 0 || newTick < oldTick)
+        repaint(phaseBounds);
+    else
+        repaint(getPhaseSegment(oldTick).getUnion(getPhaseSegment(newTick)));
+}
+
+int PulseIndicator::getTickInBeat() const
+{
+    if (pulseIndex < 0)
+        return -1;
+
+    return static_cast<int>(pulseIndex % pulsesPerQuarterNote);
+}
+
+bool PulseIndicator::isBeatLedOn() const
+{
+    const auto tick = getTickInBeat();
+    return running && tick >= 0 && tick < juce::jmax(1, pulsesPerQuarterNote / 4);
+}
+
+bool PulseIndicator::isTickLedOn() const
+{
+    return running && newTick && pulseIndex >= 0;
+}
+
+juce::Rectangle<int> PulseIndicator::getPhaseSegment(int tick) const
+{
+    const auto width = phaseBounds.getWidth();
+    const auto left = phaseBounds.getX() + (width * tick) / pulsesPerQuarterNote;
+    const auto right = phaseBounds.getX() + (width * (tick + 1)) / pulsesPerQuarterNote;
+    return { left, phaseBounds.getY(), right - left, phaseBounds.getHeight() };
+}
+
+void PulseIndicator::paint(juce::Graphics& g)
+{
+    auto drawLed = [&g](juce::Rectangle<int> bounds, bool on, juce::Colour colour) {
+        g.setColour(on ? colour : colour.withAlpha(0.15f));
+        g.fillEllipse(bounds.toFloat().reduced(2.0f));
+    };
+
+    drawLed(beatLedBounds, isBeatLedOn(), juce::Colours::orange);
+    drawLed(tickLedBounds, isTickLedOn(), juce::Colours::lightgreen);
+
+    // Phase bar: one segment per pulse, filled up to the current tick
+    g.setColour(juce::Colour(0xff2a2a2a));
+    g.fillRect(phaseBounds);
+
+    const auto tick = running ? getTickInBeat() : -1;
+    if (tick >= 0)
+    {
+        g.setColour(juce::Colours::lightgreen.withAlpha(0.6f));
+        g.fillRect(phaseBounds.withWidth(getPhaseSegment(tick).getRight() - phaseBounds.getX()));
+    }
+}
+
+void PulseIndicator::resized()
+{
+    auto bounds = getLocalBounds();
+    const auto ledSize = bounds.getHeight();
+
+    beatLedBounds = bounds.removeFromLeft(ledSize);
+    bounds.removeFromLeft(6);
+    tickLedBounds = bounds.removeFromLeft(ledSize);
+    bounds.removeFromLeft(10);
+    phaseBounds = bounds.reduced(0, ledSize / 4);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+// PulseIndicator
+// - Beat LED, tick LED and a per-tick phase bar for the current quarter note
+// - Stateless about timing: the editor pushes the latest pulse index via setState()
+//   once per frame. The tick LED is lit for the frame after a new pulse, so it flashes
+//   per tick at slow rates and stays lit when ticks outpace the display, never aliasing
+// - setState() repaints only the parts whose appearance changed; no allocation
+
+#include <JuceHeader.h>
+
+class PulseIndicator : public juce::Component
+{
+public:
+    PulseIndicator() = default;
+
+    void setState(std::int64_t newPulseIndex, int newPulsesPerQuarterNote, bool newRunning);
+
+    void paint(juce::Graphics&) override;
+    void resized() override;
+
+private:
+    std::int64_t pulseIndex = -1;
+    int pulsesPerQuarterNote = 24;
+    bool running = false;
+    bool newTick = false; // The pulse index changed at the latest setState()
+
+    juce::Rectangle<int> beatLedBounds, tickLedBounds, phaseBounds;
+
+    int getTickInBeat() const;                         // 0..PPQN-1, or -1 before the first pulse
+    bool isBeatLedOn() const;                          // Lit for the first sixteenth of each beat
+    bool isTickLedOn() const;                          // Lit for one frame after each new pulse
+    juce::Rectangle<int> getPhaseSegment(int tick) const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PulseIndicator)
+};
@@ -0,0 +1,32 @@
+#include "PulseTableCache.h"
+
+PulseTableCache::TablePtr PulseTableCache::getOrBuild(double sampleRate, int durationSamples, PulseTable::Waveform waveform)
+{
+    const juce::ScopedLock sl(lock);
+
+    for (auto* entry : tables)
+        if (entry->table.getWaveform() == waveform && entry->table.matches(sampleRate, durationSamples))
+            return entry;
+
+    releaseUnused();
+
+    TablePtr entry = new SharedTable(sampleRate, durationSamples, waveform);
+    tables.add(entry);
+    return entry;
+}
+
+void PulseTableCache::releaseUnused()
+{
+    const juce::ScopedLock sl(lock);
+
+    // A count of 1 is the cache's own reference
+    for (int i = tables.size(); --i >= 0;)
+        if (tables.getObjectPointerUnchecked(i)->getReferenceCount() == 1)
+            tables.remove(i);
+}
+
+int PulseTableCache::getNumTables() const
+{
+    const juce::ScopedLock sl(lock);
+    return tables.size();
+}
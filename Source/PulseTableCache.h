@@ -0,0 +1,47 @@
+#pragma once
+
+// PulseTableCache
+// - Process-wide store of immutable PulseTables shared by all plugin instances;
+//   hold it through juce::SharedResourcePointer so it lives as long as any instance
+// - Keyed by sample rate, pulse length in samples (i.e. width) and waveform
+// - Each table is reference counted: callers keep a TablePtr for as long as they (or
+//   an engine they feed) may read the table. When a new table is built, tables no
+//   caller holds any more are freed, so width sweeps do not pin memory
+// - Message/background threads only (locks, allocates, frees). The audio thread
+//   receives raw pointers from a holder that guarantees their lifetime
+
+#include <JuceHeader.h>
+#include "PulseTable.h"
+
+class PulseTableCache
+{
+public:
+    struct SharedTable : public juce::ReferenceCountedObject
+    {
+        SharedTable(double sampleRate, int durationSamples, PulseTable::Waveform waveform)
+            : table(sampleRate, durationSamples, waveform) {}
+
+        const PulseTable table;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedTable)
+    };
+
+    using TablePtr = juce::ReferenceCountedObjectPtr<SharedTable>;
+
+    PulseTableCache() = default;
+
+    // Returns the shared table, building it on first use
+    TablePtr getOrBuild(double sampleRate, int durationSamples,
+                        PulseTable::Waveform waveform = PulseTable::Waveform::sine1kHz);
+
+    // Frees tables that nobody outside the cache holds (also done whenever a table is built)
+    void releaseUnused();
+
+    int getNumTables() const;
+
+private:
+    juce::ReferenceCountedArray<SharedTable> tables; // Guarded by lock
+    juce::CriticalSection lock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PulseTableCache)
+};
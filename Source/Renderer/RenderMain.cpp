@@ -0,0 +1,192 @@
+// Pulse24SyncRender
+// - Headless renderer for click/sync stems, built on the same PulseGenerator as the plugin
+// - One stem per PPQN value; stems can be rendered in parallel (--jobs)
+// - Example: Pulse24SyncRender --out=click.wav --bpm=120 --ppqn=24,48 --duration=3600 --jobs=2
+
+#include <JuceHeader.h>
+#include <fstream>
+#include <iostream>
+#include "StemRenderer.h"
+#include "TempoMap.h"
+
+namespace
+{
+    void printUsage()
+    {
+        std::cout <<
+            "Usage: Pulse24SyncRender --out=<file.wav|file.flac> --duration=<seconds> [options]\n"
+            "\n"
+            "Tempo (one of):\n"
+            "  --bpm=<bpm>             Constant tempo (default 120)\n"
+            "  --tempo-map=<file.csv>  Rows of \"beat,bpm\"; beat in quarter notes from the start\n"
+            "\n"
+            "Options:\n"
+            "  --rate=<hz>             Sample rate (default 48000)\n"
+            "  --ppqn=<n>[,<n>...]     Whole pulses per quarter note; one stem per value (default 24)\n"
+            "  --width=<ms>            Pulse width, 1-50 ms (default 22)\n"
+            "  --velocity=<0-127>      Pulse level (default 127)\n"
+            "  --channels=<n>          Output channels (default 1)\n"
+            "  --bits=<16|24|32>       Bit depth (default 24)\n"
+            "  --block=<samples>       Render block size (default 512)\n"
+            "  --jobs=<n>              Stems rendered in parallel (default 1)\n";
+    }
+
+    juce::String getOption(const juce::ArgumentList& args, const char* name, const juce::String& fallback = {})
+    {
+        const auto value = args.getValueForOption(name);
+        return value.isNotEmpty() ? value : fallback;
+    }
+
+    juce::File withPpqnSuffix(const juce::File& file, int ppqn)
+    {
+        return file.getSiblingFile(file.getFileNameWithoutExtension() + "_" + juce::String(ppqn) + "ppqn"
+                                   + file.getFileExtension());
+    }
+
+    bool fail(const juce::String& message)
+    {
+        std::cerr << "Error: " << message << std::endl;
+        return false;
+    }
+
+    bool parseArguments(const juce::ArgumentList& args, std::vector<StemSettings>& stems, TempoMap& tempoMap, int& jobs)
+    {
+        const auto out = getOption(args, "--out");
+        const auto duration = getOption(args, "--duration");
+
+        if (out.isEmpty() || duration.isEmpty())
+            return fail("--out and --duration are required (see --help)");
+
+        StemSettings base;
+        base.outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(out);
+        base.durationSeconds = duration.getDoubleValue();
+        base.sampleRate = getOption(args, "--rate", "48000").getDoubleValue();
+        base.pulseWidthMs = getOption(args, "--width", "22").getFloatValue();
+        base.pulseVelocity = getOption(args, "--velocity", "127").getFloatValue();
+        base.numChannels = getOption(args, "--channels", "1").getIntValue();
+        base.bitsPerSample = getOption(args, "--bits", "24").getIntValue();
+        base.blockSize = getOption(args, "--block", "512").getIntValue();
+        jobs = getOption(args, "--jobs", "1").getIntValue();
+
+        if (base.durationSeconds <= 0.0)                       return fail("--duration must be > 0");
+        if (base.sampleRate < 8000.0 || base.sampleRate > 768000.0) return fail("--rate must be 8000-768000");
+        if (base.pulseWidthMs < 1.0f || base.pulseWidthMs > 50.0f)  return fail("--width must be 1-50 ms");
+        if (base.pulseVelocity < 0.0f || base.pulseVelocity > 127.0f) return fail("--velocity must be 0-127");
+        if (base.numChannels < 1 || base.numChannels > 64)       return fail("--channels must be 1-64");
+        if (base.blockSize < 1 || base.blockSize > 65536)        return fail("--block must be 1-65536");
+        if (jobs < 1)                                            return fail("--jobs must be >= 1");
+
+        const auto tempoMapPath = getOption(args, "--tempo-map");
+        if (tempoMapPath.isNotEmpty())
+        {
+            const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(tempoMapPath);
+            std::ifstream input(file.getFullPathName().toStdString());
+            std::string error;
+
+            if (!input)
+                return fail("Cannot read tempo map: " + file.getFullPathName());
+
+            if (!TempoMap::parseCsv(input, tempoMap, error))
+                return fail(file.getFileName() + ": " + juce::String(error));
+        }
+        else
+        {
+            const auto bpm = getOption(args, "--bpm", "120").getDoubleValue();
+            if (bpm <= 0.0)
+                return fail("--bpm must be > 0");
+
+            tempoMap = TempoMap(bpm);
+        }
+
+        auto ppqnValues = juce::StringArray::fromTokens(getOption(args, "--ppqn", "24"), ",", {});
+        ppqnValues.trim();
+        ppqnValues.removeEmptyStrings();
+
+        for (const auto& text : ppqnValues)
+        {
+            // Whole numbers only: the stems are named after their PPQN, so 24.5 would
+            // overwrite the 24 stem (as would 24 listed twice)
+            if (!text.containsOnly("0123456789"))
+                return fail("--ppqn values must be whole numbers: " + text);
+
+            const auto ppqn = text.getIntValue();
+
+            if (ppqn < 1 || ppqn > 960)
+                return fail("--ppqn values must be 1-960");
+
+            for (const auto& other : stems)
+                if (static_cast<int>(other.pulsesPerQuarterNote) == ppqn)
+                    return fail("--ppqn lists " + juce::String(ppqn) + " more than once");
+
+            auto stem = base;
+            stem.pulsesPerQuarterNote = ppqn;
+
+            if (ppqnValues.size() > 1)
+                stem.outputFile = withPpqnSuffix(base.outputFile, ppqn);
+
+            stems.push_back(stem);
+        }
+
+        if (stems.empty())
+            return fail("--ppqn needs at least one value");
+
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    if (args.size() == 0 || args.containsOption("--help|-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    std::vector<StemSettings> stems;
+    TempoMap tempoMap;
+    int jobs = 1;
+
+    if (!parseArguments(args, stems, tempoMap, jobs))
+        return 1;
+
+    std::vector<StemResult> results(stems.size());
+
+    if (jobs == 1 || stems.size() == 1)
+    {
+        for (size_t i = 0; i < stems.size(); ++i)
+            results[i] = renderStem(stems[i], tempoMap);
+    }
+    else
+    {
+        juce::ThreadPool pool(juce::jmin(jobs, static_cast<int>(stems.size())));
+
+        for (size_t i = 0; i < stems.size(); ++i)
+            pool.addJob([&, i] { results[i] = renderStem(stems[i], tempoMap); });
+
+        // Jobs don't poll shouldExit, so wait here rather than letting the pool's destructor time out
+        while (pool.getNumJobs() > 0)
+            juce::Thread::sleep(10);
+    }
+
+    int exitCode = 0;
+
+    for (size_t i = 0; i < stems.size(); ++i)
+    {
+        const auto& stem = results[i];
+
+        if (stem.result.failed())
+        {
+            std::cerr << "Error: " << stem.result.getErrorMessage() << std::endl;
+            exitCode = 1;
+            continue;
+        }
+
+        std::cout << "Wrote " << stems[i].outputFile.getFullPathName()
+                  << " (" << juce::String(stems[i].durationSeconds / juce::jmax(stem.renderSeconds, 1.0e-6), 1)
+                  << "x realtime)" << std::endl;
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,128 @@
+#include "StemRenderer.h"
+#include "PulseGenerator.h"
+#include "PulseTable.h"
+
+namespace
+{
+    // Blocks of audio the writer FIFO can hold before the render loop waits
+    constexpr int fifoBlocks = 64;
+
+    std::unique_ptr<juce::AudioFormat> createFormatFor(const juce::File& file)
+    {
+        if (file.hasFileExtension("wav"))
+            return std::make_unique<juce::WavAudioFormat>();
+
+        if (file.hasFileExtension("flac"))
+            return std::make_unique<juce::FlacAudioFormat>();
+
+        return nullptr;
+    }
+}
+
+StemResult renderStem(const StemSettings& settings, const TempoMap& tempoMap)
+{
+    StemResult stem;
+    const auto startTime = juce::Time::getMillisecondCounterHiRes();
+    const auto path = settings.outputFile.getFullPathName();
+
+    auto format = createFormatFor(settings.outputFile);
+    if (format == nullptr)
+    {
+        stem.result = juce::Result::fail("Unsupported output format (use .wav or .flac): " + path);
+        return stem;
+    }
+
+    settings.outputFile.deleteFile();
+    std::unique_ptr<juce::OutputStream> stream(settings.outputFile.createOutputStream());
+    if (stream == nullptr)
+    {
+        stem.result = juce::Result::fail("Cannot open for writing: " + path);
+        return stem;
+    }
+
+    std::unique_ptr<juce::AudioFormatWriter> writer(format->createWriterFor(stream.get(),
+                                                                            settings.sampleRate,
+                                                                            static_cast<unsigned int>(settings.numChannels),
+                                                                            settings.bitsPerSample,
+                                                                            {}, 0));
+    if (writer == nullptr)
+    {
+        stem.result = juce::Result::fail(format->getFormatName() + " cannot write " + juce::String(settings.sampleRate)
+                                         + " Hz / " + juce::String(settings.bitsPerSample) + " bit: " + path);
+        return stem;
+    }
+
+    stream.release(); // Owned by the writer now
+
+    const auto totalSamples = static_cast<juce::int64>(std::llround(settings.durationSeconds * settings.sampleRate));
+
+    {
+        juce::TimeSliceThread writerThread("Pulse24Sync writer");
+        writerThread.startThread();
+
+        juce::AudioFormatWriter::ThreadedWriter threadedWriter(writer.release(), writerThread,
+                                                               settings.blockSize * fifoBlocks);
+
+        PulseGenerator generator;
+        generator.prepare(settings.sampleRate);
+        generator.setPulsesPerQuarterNote(settings.pulsesPerQuarterNote);
+        generator.setPulseWidth(settings.pulseWidthMs);
+        generator.setPulseVelocity(settings.pulseVelocity);
+        generator.setSyncToHost(true);
+        generator.setHostIsPlaying(true);
+
+        PulseTable pulseTable(settings.sampleRate, generator.getPulseDurationSamples());
+        generator.setPulseTable(&pulseTable);
+
+        juce::AudioBuffer<float> block(settings.numChannels, settings.blockSize);
+
+        for (juce::int64 position = 0; position < totalSamples;)
+        {
+            const auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(settings.blockSize),
+                                                                totalSamples - position));
+            block.clear();
+
+            // A tempo change inside the block starts a sub-block at the first sample at or
+            // after it, so the engine follows the map to the sample, not to the block
+            for (int offset = 0; offset < numSamples;)
+            {
+                const auto samplePosition = position + offset;
+                const double seconds = static_cast<double>(samplePosition) / settings.sampleRate;
+                const double nextChange = tempoMap.getNextChangeTimeAfter(seconds) * settings.sampleRate;
+
+                int length = numSamples - offset;
+                if (nextChange < static_cast<double>(samplePosition + length))
+                    length = juce::jmax(1, static_cast<int>(std::ceil(nextChange) - static_cast<double>(samplePosition)));
+
+                generator.setHostTempo(tempoMap.getTempoAtTime(seconds));
+                generator.setHostPPQPosition(tempoMap.getPpqAtTime(seconds));
+                generator.setHostPosition(seconds);
+
+                juce::AudioBuffer<float> subBlock(block.getArrayOfWritePointers(), settings.numChannels, offset, length);
+                generator.process(subBlock.getArrayOfWritePointers(), settings.numChannels, length);
+
+                offset += length;
+            }
+
+            // Back-pressure: wait for the writer thread to drain the FIFO
+            while (!threadedWriter.write(block.getArrayOfReadPointers(), numSamples))
+                juce::Thread::sleep(1);
+
+            position += numSamples;
+        }
+
+        // ThreadedWriter flushes the FIFO and closes the file when it goes out of scope
+    }
+
+    // The writer thread drops failed writes silently (disk full, file removed), so
+    // read the header back to check that every sample reached the file
+    std::unique_ptr<juce::AudioFormatReader> reader(format->createReaderFor(settings.outputFile.createInputStream().release(), true));
+    const auto writtenSamples = reader != nullptr ? reader->lengthInSamples : juce::int64 { 0 };
+
+    if (writtenSamples != totalSamples)
+        stem.result = juce::Result::fail("Incomplete write (" + juce::String(writtenSamples) + " of "
+                                         + juce::String(totalSamples) + " samples): " + path);
+
+    stem.renderSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) * 0.001;
+    return stem;
+}
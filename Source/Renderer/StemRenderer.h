@@ -0,0 +1,34 @@
+#pragma once
+
+// StemRenderer
+// - Offline rendering of one pulse-train stem to WAV or FLAC (chosen by file extension)
+// - Drives PulseGenerator like a host transport would: per block, tempo and PPQ
+//   position come from a TempoMap. Blocks are split at tempo changes, so ticks
+//   follow the map to the sample.
+// - Fixed-size blocks go through a bounded FIFO to a background writer thread
+//   (AudioFormatWriter::ThreadedWriter), so memory use does not grow with duration
+// - The finished file's length is checked against the render; a short file fails the result
+
+#include <JuceHeader.h>
+#include "TempoMap.h"
+
+struct StemSettings
+{
+    juce::File outputFile;
+    double sampleRate = 48000.0;
+    int numChannels = 1;
+    int bitsPerSample = 24;
+    double pulsesPerQuarterNote = 24.0;
+    float pulseWidthMs = 22.0f;
+    float pulseVelocity = 127.0f;  // MIDI scale, as the plugin parameter
+    double durationSeconds = 60.0;
+    int blockSize = 512;
+};
+
+struct StemResult
+{
+    juce::Result result = juce::Result::ok();
+    double renderSeconds = 0.0;    // Wall-clock time including the final flush
+};
+
+StemResult renderStem(const StemSettings& settings, const TempoMap& tempoMap);
@@ -0,0 +1,266 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "PluginProcessor.h"
+#include "SoakHarness.h"
+
+namespace
+{
+    // Loudest possible sample: unit shape x full velocity x the engine's 0.1 output scale
+    constexpr double maxPulseLevel = 0.1 + 1.0e-6;
+
+    // Longest pulse tail after the transport stops (maximum pulse width)
+    constexpr double maxTailSeconds = 0.050;
+
+    // Playhead whose answers the test scripts between blocks, including hosts that
+    // report no position at all or a position without PPQ
+    class ScriptedPlayHead : public juce::AudioPlayHead
+    {
+    public:
+        enum class Report { full, noPpq, nothing };
+
+        Report report = Report::full;
+        bool playing = true;
+        Soak::Transport transport;
+        double reportedPpq = 0.0; // transport.ppq as the host reports it for the next block (with jitter)
+
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            if (report == Report::nothing)
+                return {};
+
+            PositionInfo info;
+            info.setIsPlaying(playing);
+            info.setBpm(transport.bpm);
+            if (report == Report::full)
+                info.setPpqPosition(reportedPpq);
+            return info;
+        }
+    };
+
+    std::int64_t expectedPulseIndex(double ppq, double ppqn)
+    {
+        return static_cast<std::int64_t>(std::ceil(ppq * ppqn - 1.0e-9)) - 1;
+    }
+
+    template <typename SampleType>
+    bool outputIsFiniteAndBounded(const juce::AudioBuffer<SampleType>& buffer)
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            if (!Soak::isFiniteAndBounded(buffer.getReadPointer(ch), buffer.getNumSamples(), maxPulseLevel))
+                return false;
+
+        return true;
+    }
+
+    // First sample index from which the output must be silent, given how long the engine has been quiet
+    // (two samples of slack for pulse lengths rounded to whole samples across rate changes)
+    int firstSilentSample(double quietSeconds, double sampleRate)
+    {
+        return std::max(0, static_cast<int>(std::ceil((maxTailSeconds - quietSeconds) * sampleRate)) + 2);
+    }
+
+    template <typename SampleType>
+    bool isSilentFrom(const juce::AudioBuffer<SampleType>& buffer, int startSample)
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            for (int i = startSample; i < buffer.getNumSamples(); ++i)
+                if (buffer.getSample(ch, i) != SampleType(0))
+                    return false;
+
+        return true;
+    }
+}
+
+TEST_CASE("Soak: processor survives adversarial hosts", "[soak]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser; // Message manager for the processor's table timer
+
+    auto rng = Soak::makeRandom();
+    Soak::Deadline deadline;
+
+    constexpr int maxBlockSize = 4096;
+    juce::AudioBuffer<float> floatStorage(2, maxBlockSize);
+    juce::AudioBuffer<double> doubleStorage(2, maxBlockSize);
+    juce::MidiBuffer midi;
+
+    std::int64_t totalBlocks = 0;
+    int runs = 0;
+
+    while (!deadline.expired())
+    {
+        ++runs;
+
+        double sampleRate = Soak::randomSampleRate(rng);
+
+        Pulse24SyncAudioProcessor processor;
+        ScriptedPlayHead playHead;
+        playHead.transport.bpm = Soak::randomTempo(rng);
+        playHead.transport.ppq = std::uniform_real_distribution<double>(0.0, 100.0)(rng);
+        playHead.transport.jitterSamples = Soak::pick(rng, { 0, 0, 2, 8 });
+
+        processor.setPlayHead(&playHead);
+        processor.setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+        processor.prepareToPlay(sampleRate, maxBlockSize);
+
+        auto& parameters = processor.parameters;
+        const auto setParameter = [&parameters](const char* id, float value)
+        {
+            auto* parameter = parameters.getParameter(id);
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+        };
+
+        double quietSeconds = 0.0; // Time since the processor last had a reason to sound
+        Soak::TickAudit tickAudit(playHead.transport.jitterSamples);
+
+        for (int block = 0; block < 500; ++block, ++totalBlocks)
+        {
+            // Host and user events between blocks. Any of them but a tempo or rate change
+            // interrupts the synced playback the tick audit follows.
+            bool interrupted = false;
+
+            if (Soak::chance(rng, 0.02))
+                playHead.transport.bpm = Soak::chance(rng, 0.1) ? 0.0 : Soak::randomTempo(rng); // Includes a zero tempo
+            if (Soak::chance(rng, 0.02))
+            {
+                playHead.transport.ppq = std::uniform_real_distribution<double>(0.0, 200.0)(rng); // Jump / rewind / loop
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.02))
+            {
+                playHead.playing = !playHead.playing;
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.02))
+            {
+                playHead.report = Soak::pick(rng, { ScriptedPlayHead::Report::full, ScriptedPlayHead::Report::full,
+                                                    ScriptedPlayHead::Report::noPpq, ScriptedPlayHead::Report::nothing });
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.01))
+            {
+                processor.setPlayHead(processor.getPlayHead() != nullptr ? nullptr : &playHead); // Playhead goes away / returns
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.01))
+            {
+                // Rate change without a prepareToPlay(); the engine must pick it up mid-stream
+                sampleRate = Soak::randomSampleRate(rng);
+                processor.setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+            }
+            if (Soak::chance(rng, 0.005))
+            {
+                sampleRate = Soak::randomSampleRate(rng);
+                processor.setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+                processor.prepareToPlay(sampleRate, maxBlockSize);
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.02))
+                setParameter(PluginParams::pulseWidth, std::uniform_real_distribution<float>(1.0f, 50.0f)(rng));
+            if (Soak::chance(rng, 0.02))
+                setParameter(PluginParams::manualBPM, std::uniform_real_distribution<float>(60.0f, 200.0f)(rng));
+            if (Soak::chance(rng, 0.01))
+            {
+                setParameter(PluginParams::enabled, Soak::chance(rng, 0.8) ? 1.0f : 0.0f);
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.01))
+            {
+                setParameter(PluginParams::syncToHost, Soak::chance(rng, 0.8) ? 1.0f : 0.0f);
+                interrupted = true;
+            }
+            if (Soak::chance(rng, 0.01))
+            {
+                // Programs never switch the clock on or off
+                const auto enabledBefore = parameters.getRawParameterValue(PluginParams::enabled)->load();
+                processor.setCurrentProgram(std::uniform_int_distribution<int>(0, processor.getNumPrograms() - 1)(rng));
+                REQUIRE(parameters.getRawParameterValue(PluginParams::enabled)->load() == enabledBefore);
+                interrupted = true;
+            }
+
+            const int numSamples = Soak::randomBlockSize(rng, maxBlockSize);
+            const bool useDouble = Soak::chance(rng, 0.5);
+
+            // Views onto preallocated storage, so the host side stays allocation-free too
+            juce::AudioBuffer<float> floatBuffer(floatStorage.getArrayOfWritePointers(), 2, numSamples);
+            juce::AudioBuffer<double> doubleBuffer(doubleStorage.getArrayOfWritePointers(), 2, numSamples);
+
+            playHead.reportedPpq = playHead.transport.reportPpq(rng, sampleRate);
+
+            if (useDouble)
+            {
+                processor.processBlock(doubleBuffer, midi);
+                tickAudit.addAudio(doubleBuffer.getReadPointer(0), numSamples);
+            }
+            else
+            {
+                processor.processBlock(floatBuffer, midi);
+                tickAudit.addAudio(floatBuffer.getReadPointer(0), numSamples);
+            }
+
+            const bool hasPosition = processor.getPlayHead() != nullptr && playHead.report != ScriptedPlayHead::Report::nothing;
+            const bool running = hasPosition && playHead.playing && parameters.getRawParameterValue(PluginParams::enabled)->load() >= 0.5f;
+            const bool synced = running && playHead.report == ScriptedPlayHead::Report::full
+                                && parameters.getRawParameterValue(PluginParams::syncToHost)->load() >= 0.5f;
+
+            INFO("run " << runs << " block " << block << " size " << numSamples << " rate " << sampleRate
+                 << " bpm " << playHead.transport.bpm << " ppq " << playHead.transport.ppq
+                 << " running " << running << " synced " << synced << " double " << useDouble);
+
+            // No NaN/Inf and never louder than one full-scale pulse
+            if (useDouble)
+                REQUIRE(outputIsFiniteAndBounded(doubleBuffer));
+            else
+                REQUIRE(outputIsFiniteAndBounded(floatBuffer));
+
+            REQUIRE(processor.displayState.running.load() == running);
+
+            // Stopped, disabled or without playhead data: only the last pulse's tail may sound
+            if (running)
+            {
+                quietSeconds = 0.0;
+            }
+            else
+            {
+                const int silentFrom = firstSilentSample(quietSeconds, sampleRate);
+                if (useDouble)
+                    REQUIRE(isSilentFrom(doubleBuffer, silentFrom));
+                else
+                    REQUIRE(isSilentFrom(floatBuffer, silentFrom));
+
+                quietSeconds += numSamples / sampleRate;
+            }
+
+            if (hasPosition && playHead.playing)
+                playHead.transport.advance(numSamples, sampleRate);
+
+            // Host-synced with full position info: the published pulse stays within a tick of the host grid
+            const bool zeroTempo = !(playHead.transport.bpm > 0.0);
+            if (synced && !zeroTempo)
+            {
+                const auto ppqn = processor.displayState.pulsesPerQuarterNote.load();
+                const auto phaseError = processor.displayState.pulseIndex.load()
+                                      - expectedPulseIndex(playHead.transport.ppq, ppqn);
+                REQUIRE(phaseError >= -1);
+                REQUIRE(phaseError <= 1);
+            }
+
+            // No duplicated or dropped ticks in the audio while synced without interruption
+            if (!synced || zeroTempo || interrupted)
+            {
+                tickAudit.restart();
+            }
+            else
+            {
+                const auto tickError = tickAudit.update(playHead.transport.ppq, processor.displayState.pulsesPerQuarterNote.load(),
+                                                        playHead.transport.bpm, sampleRate);
+                INFO("onsets " << tickAudit.getOnsetsInStretch() << " ticks " << tickAudit.getTicksInStretch()
+                     << " jitter " << playHead.transport.jitterSamples);
+                REQUIRE(tickError == 0);
+            }
+        }
+
+        processor.releaseResources();
+    }
+
+    WARN("Processor soak: " << runs << " runs, " << totalBlocks << " blocks in " << Soak::getTimeBudgetSeconds() << " s");
+}
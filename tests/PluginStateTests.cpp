@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "PluginProcessor.h"
+#include "PluginState.h"
+
+static PluginState::Values makeValues(int seed)
+{
+    PluginState::Values values;
+    values.enabled = (seed % 2) == 0;
+    values.pulseVelocity = static_cast<float>(seed % 128);
+    values.pulseWidth = 1.0f + static_cast<float>(seed % 50);
+    values.syncToHost = (seed % 3) != 0;
+    values.manualBPM = 60.0f + static_cast<float>(seed % 141);
+    values.program = seed % 7;
+    return values;
+}
+
+// Mirrors what AudioProcessorValueTreeState::copyState().createXml() produced in earlier releases
+static std::unique_ptr<juce::XmlElement> makeLegacyXml(const PluginState::Values& values)
+{
+    auto xml = std::make_unique<juce::XmlElement>("Pulse24Sync");
+
+    auto addParam = [&xml](const char* id, float value) {
+        auto* param = xml->createNewChildElement("PARAM");
+        param->setAttribute("id", id);
+        param->setAttribute("value", value);
+    };
+
+    addParam(PluginParams::enabled, values.enabled ? 1.0f : 0.0f);
+    addParam(PluginParams::pulseVelocity, values.pulseVelocity);
+    addParam(PluginParams::pulseWidth, values.pulseWidth);
+    addParam(PluginParams::syncToHost, values.syncToHost ? 1.0f : 0.0f);
+    addParam(PluginParams::manualBPM, values.manualBPM);
+    return xml;
+}
+
+static void requireEqual(const PluginState::Values& a, const PluginState::Values& b)
+{
+    REQUIRE(a.enabled == b.enabled);
+    REQUIRE(a.pulseVelocity == Catch::Approx(b.pulseVelocity));
+    REQUIRE(a.pulseWidth == Catch::Approx(b.pulseWidth));
+    REQUIRE(a.syncToHost == b.syncToHost);
+    REQUIRE(a.manualBPM == Catch::Approx(b.manualBPM));
+    REQUIRE(a.program == b.program);
+}
+
+TEST_CASE("Binary state round-trips all values", "[state]")
+{
+    const auto original = makeValues(7);
+
+    juce::MemoryBlock block;
+    PluginState::write(original, block);
+    REQUIRE(block.getSize() == 8 + 6 * sizeof(float));
+
+    PluginState::Values decoded;
+    REQUIRE(PluginState::read(block.getData(), static_cast<int>(block.getSize()), decoded));
+    requireEqual(decoded, original);
+}
+
+TEST_CASE("Binary state rejects foreign, truncated and newer blobs", "[state]")
+{
+    juce::MemoryBlock block;
+    PluginState::write(makeValues(3), block);
+    PluginState::Values decoded;
+
+    SECTION("Truncated")
+    {
+        REQUIRE_FALSE(PluginState::read(block.getData(), static_cast<int>(block.getSize()) - 1, decoded));
+    }
+
+    SECTION("Unknown magic (e.g. legacy XML blob)")
+    {
+        static_cast<char*>(block.getData())[0] = 'V';
+        REQUIRE_FALSE(PluginState::read(block.getData(), static_cast<int>(block.getSize()), decoded));
+    }
+
+    SECTION("Schema version from the future")
+    {
+        static_cast<juce::uint8*>(block.getData())[4] = static_cast<juce::uint8>(PluginState::currentVersion + 1);
+        REQUIRE_FALSE(PluginState::read(block.getData(), static_cast<int>(block.getSize()), decoded));
+    }
+}
+
+TEST_CASE("Version 1 blobs load with the first program selected", "[state]")
+{
+    // v1 layout: header + enabled, velocity, width, sync, manual BPM
+    juce::MemoryBlock block;
+    juce::MemoryOutputStream out(block, false);
+    out.write("P24S", 4);
+    out.writeShort(1);
+    out.writeShort(5);
+    for (auto field : { 0.0f, 90.0f, 12.0f, 1.0f, 133.0f })
+        out.writeFloat(field);
+    out.flush();
+
+    PluginState::Values decoded;
+    decoded.program = 4;
+    REQUIRE(PluginState::read(block.getData(), static_cast<int>(block.getSize()), decoded));
+    REQUIRE_FALSE(decoded.enabled);
+    REQUIRE(decoded.pulseWidth == Catch::Approx(12.0f));
+    REQUIRE(decoded.manualBPM == Catch::Approx(133.0f));
+    REQUIRE(decoded.program == 0);
+}
+
+TEST_CASE("Legacy XML state decodes to the same values", "[state]")
+{
+    auto original = makeValues(11);
+    original.program = 0; // Not part of the legacy XML state
+    auto xml = makeLegacyXml(original);
+
+    PluginState::Values decoded;
+    REQUIRE(PluginState::readXml(*xml, decoded));
+    requireEqual(decoded, original);
+
+    juce::XmlElement wrongTag("SomethingElse");
+    REQUIRE_FALSE(PluginState::readXml(wrongTag, decoded));
+}
+
+TEST_CASE("Session load: binary vs XML state for 1000 instances", "[state][.benchmark]")
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser; // Message manager for the processor's table timer
+
+    // Both paths go through setStateInformation(), as a host restoring a session does;
+    // the legacy blobs are what copyXmlToBinary() wrote in earlier releases
+    constexpr int numBlobs = 1000;
+    std::vector<juce::MemoryBlock> binaryBlobs(numBlobs);
+    std::vector<juce::MemoryBlock> xmlBlobs(numBlobs);
+
+    for (int i = 0; i < numBlobs; ++i)
+    {
+        PluginState::write(makeValues(i), binaryBlobs[static_cast<size_t>(i)]);
+        juce::AudioProcessor::copyXmlToBinary(*makeLegacyXml(makeValues(i)), xmlBlobs[static_cast<size_t>(i)]);
+    }
+
+    Pulse24SyncAudioProcessor processor;
+    auto* manualBPM = processor.parameters.getRawParameterValue(PluginParams::manualBPM);
+
+    auto loadAll = [&](const std::vector<juce::MemoryBlock>& blobs) {
+        float checksum = 0.0f;
+        for (auto& blob : blobs)
+        {
+            processor.setStateInformation(blob.getData(), static_cast<int>(blob.getSize()));
+            checksum += manualBPM->load();
+        }
+        return checksum;
+    };
+
+    BENCHMARK("Binary setStateInformation x1000")
+    {
+        return loadAll(binaryBlobs);
+    };
+
+    BENCHMARK("XML (getXmlFromBinary) setStateInformation x1000")
+    {
+        return loadAll(xmlBlobs);
+    };
+}
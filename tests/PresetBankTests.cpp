@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "PresetBank.h"
+
+TEST_CASE("Preset bank exposes pre-built presets", "[presets]")
+{
+    PresetBank bank;
+    REQUIRE(bank.size() > 1);
+
+    bank.prepare(48000.0);
+
+    for (int i = 0; i < bank.size(); ++i)
+    {
+        const auto& preset = bank.get(i);
+        REQUIRE(preset.name.isNotEmpty());
+        REQUIRE(preset.pulseTable != nullptr);
+        REQUIRE(preset.pulseTable->matches(48000.0, static_cast<int>(48000.0 * preset.values.pulseWidth * 0.001)));
+    }
+}
+
+TEST_CASE("Selecting a preset hands it to the audio thread exactly once", "[presets]")
+{
+    PresetBank bank;
+    REQUIRE(bank.takePending() == nullptr);
+
+    bank.select(2);
+    REQUIRE(bank.getCurrentIndex() == 2);
+
+    auto* pending = bank.takePending();
+    REQUIRE(pending == &bank.get(2));
+    REQUIRE(bank.takePending() == nullptr);
+
+    SECTION("Only the latest selection is delivered")
+    {
+        bank.select(1);
+        bank.select(3);
+        REQUIRE(bank.takePending() == &bank.get(3));
+        REQUIRE(bank.takePending() == nullptr);
+    }
+
+    SECTION("Restoring a session makes a program current without queueing it")
+    {
+        bank.restore(4);
+        REQUIRE(bank.getCurrentIndex() == 4);
+        REQUIRE(bank.takePending() == nullptr);
+    }
+
+    SECTION("Out-of-range selections are ignored")
+    {
+        bank.select(bank.size());
+        REQUIRE(bank.getCurrentIndex() == 2);
+        REQUIRE(bank.takePending() == nullptr);
+    }
+}
@@ -0,0 +1,231 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "PulseGenerator.h"
+#include "SoakHarness.h"
+
+namespace
+{
+    // Loudest possible sample: unit shape x full velocity x the engine's 0.1 output scale
+    constexpr double maxPulseLevel = 0.1 + 1.0e-6;
+
+    // Index of the pulse that should have started most recently at a host position
+    // (pulse k starts at PPQ k / PPQN, the end of a block is exclusive)
+    std::int64_t expectedPulseIndex(double ppq, double ppqn)
+    {
+        return static_cast<std::int64_t>(std::ceil(ppq * ppqn - 1.0e-9)) - 1;
+    }
+}
+
+TEST_CASE("Soak: engine keeps host-synced ticks under adversarial hosts", "[soak]")
+{
+    auto rng = Soak::makeRandom();
+    Soak::Deadline deadline;
+
+    constexpr int maxBlockSize = 4096;
+    std::vector<float> left(maxBlockSize), right(maxBlockSize);
+    float* channels[] = { left.data(), right.data() };
+
+    std::int64_t totalBlocks = 0;
+    int runs = 0;
+
+    while (!deadline.expired())
+    {
+        ++runs;
+
+        double sampleRate = Soak::randomSampleRate(rng);
+        const double ppqn = Soak::pick(rng, { 24.0, 48.0, 96.0 });
+        const int numChannels = Soak::pick(rng, { 1, 2 });
+
+        Soak::Transport transport;
+        transport.bpm = Soak::randomTempo(rng);
+        transport.ppq = Soak::chance(rng, 0.5) ? 0.0 : std::uniform_real_distribution<double>(0.0, 500.0)(rng);
+        transport.jitterSamples = Soak::pick(rng, { 0, 0, 2, 8 });
+        bool ppqMissing = false;
+
+        PulseGenerator gen;
+        gen.prepare(sampleRate);
+        gen.setPulsesPerQuarterNote(ppqn);
+        gen.setPulseWidth(std::uniform_real_distribution<float>(1.0f, 50.0f)(rng)); // Includes pulses wider than a tick
+        gen.setPulseVelocity(std::uniform_real_distribution<float>(1.0f, 127.0f)(rng)); // Audible, so onsets can be counted
+        gen.setSyncToHost(true);
+        gen.setHostIsPlaying(true);
+
+        std::int64_t previousIndex = gen.getPulseIndex();
+
+        Soak::TickAudit tickAudit(transport.jitterSamples);
+
+        for (int block = 0; block < 2000; ++block, ++totalBlocks)
+        {
+            // Host events between blocks
+            bool movedBack = false;
+            bool jumped = false;
+
+            if (Soak::chance(rng, 0.01))
+                transport.bpm = Soak::randomTempo(rng);                                          // Tempo jump
+            if (Soak::chance(rng, 0.005))
+                sampleRate = Soak::randomSampleRate(rng);                                        // Rate change
+            if (Soak::chance(rng, 0.01))
+            {
+                transport.ppq += std::uniform_real_distribution<double>(1.0, 64.0)(rng);         // Jump ahead
+                jumped = true;
+            }
+            // Moves back by less than the engine's 2 ms jitter window are indistinguishable from jitter
+            const double minimumMove = 0.01 * transport.bpm / 60.0; // 10 ms in quarter notes
+
+            if (Soak::chance(rng, 0.01) && transport.ppq > minimumMove)
+            {
+                transport.ppq = std::uniform_real_distribution<double>(0.0, transport.ppq - minimumMove)(rng); // Rewind / loop
+                movedBack = true;
+            }
+            if (Soak::chance(rng, 0.005) && transport.ppq > minimumMove)
+            {
+                transport.ppq = 0.0;                                                             // Back to start
+                movedBack = true;
+            }
+            if (Soak::chance(rng, 0.005))
+            {
+                ppqMissing = !ppqMissing;                                                        // PPQ drops out / returns
+                movedBack = true; // Realigning after a gap may step back to the host grid
+            }
+
+            jumped = jumped || movedBack;
+
+            const int numSamples = Soak::randomBlockSize(rng, maxBlockSize);
+
+            gen.setHostTempo(transport.bpm);
+            if (ppqMissing)
+                gen.clearHostPPQPosition();
+            else
+                gen.setHostPPQPosition(transport.reportPpq(rng, sampleRate));
+            gen.setSampleRate(sampleRate);
+
+            std::fill(left.begin(), left.begin() + numSamples, 0.0f);
+            std::fill(right.begin(), right.begin() + numSamples, 0.0f);
+            gen.process(channels, numChannels, numSamples);
+            tickAudit.addAudio(left.data(), numSamples);
+            transport.advance(numSamples, sampleRate);
+
+            const auto index = gen.getPulseIndex();
+            INFO("run " << runs << " block " << block << " ppq " << transport.ppq << " bpm " << transport.bpm
+                 << " rate " << sampleRate << " size " << numSamples << " index " << index
+                 << " expected " << expectedPulseIndex(transport.ppq, ppqn));
+
+            // No NaN/Inf, no overlapping pulses summing beyond one full-scale pulse
+            for (int ch = 0; ch < numChannels; ++ch)
+                REQUIRE(Soak::isFiniteAndBounded(channels[ch], numSamples, maxPulseLevel));
+
+            // No duplicated ticks: the pulse count only goes back when the transport does
+            if (!movedBack)
+                REQUIRE(index >= previousIndex);
+            previousIndex = index;
+
+            // No missed or early ticks: every pulse up to the host position has started, within one tick
+            if (!ppqMissing)
+            {
+                const auto phaseError = index - expectedPulseIndex(transport.ppq, ppqn);
+                REQUIRE(phaseError >= -1);
+                REQUIRE(phaseError <= 1);
+            }
+
+            // No duplicated or dropped ticks in the audio. A jump (or a PPQ gap) starts a new
+            // stretch after the block that realigns to it.
+            if (jumped || ppqMissing)
+                tickAudit.restart();
+
+            const auto tickError = tickAudit.update(transport.ppq, ppqn, transport.bpm, sampleRate);
+            INFO("onsets " << tickAudit.getOnsetsInStretch() << " ticks " << tickAudit.getTicksInStretch()
+                 << " jitter " << transport.jitterSamples);
+            REQUIRE(tickError == 0);
+        }
+    }
+
+    WARN("Engine soak: " << runs << " runs, " << totalBlocks << " blocks in " << Soak::getTimeBudgetSeconds() << " s");
+}
+
+TEST_CASE("Soak: engine stays silent and finite when stopped or disabled mid-stream", "[soak]")
+{
+    auto rng = Soak::makeRandom();
+    Soak::Deadline deadline;
+
+    constexpr int maxBlockSize = 4096;
+    std::vector<double> left(maxBlockSize), right(maxBlockSize);
+    double* channels[] = { left.data(), right.data() };
+
+    std::int64_t totalBlocks = 0;
+
+    while (!deadline.expired())
+    {
+        double sampleRate = Soak::randomSampleRate(rng);
+
+        PulseGenerator gen;
+        gen.prepare(sampleRate);
+        gen.setPulseWidth(std::uniform_real_distribution<float>(1.0f, 50.0f)(rng));
+        gen.setSyncToHost(Soak::chance(rng, 0.5));
+        gen.setManualBPM(static_cast<float>(Soak::randomTempo(rng)));
+
+        Soak::Transport transport;
+        bool playing = true;
+        bool enabled = true;
+        int tailSamples = 0; // Samples rendered since the engine last went quiet
+
+        for (int block = 0; block < 2000; ++block, ++totalBlocks)
+        {
+            if (Soak::chance(rng, 0.02))
+                playing = !playing;
+            if (Soak::chance(rng, 0.02))
+                enabled = !enabled;
+            if (Soak::chance(rng, 0.01))
+                transport.bpm = Soak::chance(rng, 0.2) ? 0.0 : Soak::randomTempo(rng); // Includes a zero tempo
+            if (Soak::chance(rng, 0.01))
+                gen.setManualBPM(static_cast<float>(Soak::randomTempo(rng)));
+            if (Soak::chance(rng, 0.005))
+            {
+                // The engine rescales a sounding tail to the new rate, so rescale what has elapsed of it
+                const double newSampleRate = Soak::randomSampleRate(rng);
+                tailSamples = static_cast<int>(tailSamples * newSampleRate / sampleRate);
+                sampleRate = newSampleRate;
+            }
+
+            const int numSamples = Soak::randomBlockSize(rng, maxBlockSize);
+            const bool wasRunning = gen.getEnabled() && gen.getHostIsPlaying();
+
+            gen.setEnabled(enabled);
+            gen.setHostIsPlaying(playing);
+            gen.setHostTempo(transport.bpm);
+            gen.setHostPPQPosition(transport.ppq);
+            gen.setSampleRate(sampleRate);
+
+            std::fill(left.begin(), left.begin() + numSamples, 0.0);
+            std::fill(right.begin(), right.begin() + numSamples, 0.0);
+            gen.process(channels, 2, numSamples);
+            transport.advance(numSamples, sampleRate);
+
+            INFO("block " << block << " size " << numSamples << " rate " << sampleRate << " bpm " << transport.bpm);
+            REQUIRE(Soak::isFiniteAndBounded(left.data(), numSamples, maxPulseLevel));
+            REQUIRE(Soak::isFiniteAndBounded(right.data(), numSamples, maxPulseLevel));
+
+            // Once stopped or disabled, only the tail of the last pulse may sound
+            if (enabled && playing)
+            {
+                tailSamples = 0;
+            }
+            else
+            {
+                if (wasRunning)
+                    tailSamples = 0;
+
+                const int tailLimit = std::max(0, gen.getPulseDurationSamples() - tailSamples);
+                for (int i = tailLimit; i < numSamples; ++i)
+                    REQUIRE(left[static_cast<size_t>(i)] == 0.0);
+
+                tailSamples += numSamples;
+            }
+        }
+    }
+
+    WARN("Engine stop/disable soak: " << totalBlocks << " blocks in " << Soak::getTimeBudgetSeconds() << " s");
+}
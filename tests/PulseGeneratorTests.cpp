@@ -1,13 +1,60 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include "PulseGenerator.h"
 
-static juce::AudioBuffer<float> makeBuffer(int numChannels, int numSamples)
+// Minimal planar buffer so these tests build against Pulse24SyncCore alone (no JUCE)
+template <typename SampleType>
+class TestBuffer
+{
+public:
+    TestBuffer(int numChannels, int numSamples)
+        : data(static_cast<size_t>(numChannels), std::vector<SampleType>(static_cast<size_t>(numSamples)))
+    {
+        for (auto& channel : data)
+            pointers.push_back(channel.data());
+    }
+
+    TestBuffer(const TestBuffer&) = delete;
+    TestBuffer& operator=(const TestBuffer&) = delete;
+
+    int getNumChannels() const { return static_cast<int>(data.size()); }
+    int getNumSamples() const { return data.empty() ? 0 : static_cast<int>(data[0].size()); }
+    const SampleType* getReadPointer(int channel) const { return data[static_cast<size_t>(channel)].data(); }
+    SampleType* const* getArrayOfWritePointers() { return pointers.data(); }
+
+    void clear()
+    {
+        for (auto& channel : data)
+            std::fill(channel.begin(), channel.end(), SampleType());
+    }
+
+private:
+    std::vector<std::vector<SampleType>> data;
+    std::vector<SampleType*> pointers;
+};
+
+static TestBuffer<float> makeBuffer(int numChannels, int numSamples)
 {
-    juce::AudioBuffer<float> buffer(numChannels, numSamples);
-    buffer.clear();
-    return buffer;
+    return TestBuffer<float>(numChannels, numSamples);
+}
+
+// Pulse onsets in a rendered block. A pulse starts at sine phase 0, so the sample
+// before its first audible one is the onset.
+static std::vector<int> findOnsets(const TestBuffer<float>& buffer)
+{
+    std::vector<int> onsets;
+    const auto* data = buffer.getReadPointer(0);
+
+    for (int i = 1; i < buffer.getNumSamples(); ++i)
+        if (data[i] != 0.0f && data[i - 1] == 0.0f)
+            onsets.push_back(i - 1);
+
+    return onsets;
 }
 
 TEST_CASE("Pulse rate math at common BPM", "[pulse]")
@@ -23,7 +70,7 @@ TEST_CASE("Pulse rate math at common BPM", "[pulse]")
     SECTION("120 BPM -> 48k/((120/60)*24) samples per pulse")
     {
         gen.setManualBPM(120.0f);
-        juce::AudioBuffer<float> buffer = makeBuffer(2, 48000);
+        auto buffer = makeBuffer(2, 48000);
         gen.process(buffer.getNumSamples(), sampleRate, buffer);
 
         // At 120 BPM and 24 PPQN, pulses per second = 48. Samples per pulse = 1000.
@@ -102,4 +149,464 @@ TEST_CASE("Pulse width updates pulse duration samples", "[pulse]")
     // 10ms at 44.1k is ~441 samples; allow margin due to envelope rounding
     REQUIRE(nonZeroLen >= 300);
     REQUIRE(nonZeroLen <= 600);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Stopping mid-pulse lets the tail finish, then goes idle", "[pulse]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setSyncToHost(false);
+    gen.setManualBPM(120.0f);
+    gen.setHostIsPlaying(true);
+
+    // First pulse starts at sample 0 and lasts 22ms (1056 samples at 48k)
+    auto buffer = makeBuffer(1, 256);
+    gen.process(buffer.getNumSamples(), sampleRate, buffer);
+    REQUIRE(gen.isPulseActive());
+
+    // Transport stops: the remainder of the pulse is still rendered
+    gen.setHostIsPlaying(false);
+    auto tail = makeBuffer(1, 2048);
+    gen.process(tail.getNumSamples(), sampleRate, tail);
+
+    int lastNonZero = -1;
+    for (int i = 0; i < tail.getNumSamples(); ++i)
+        if (tail.getReadPointer(0)[i] != 0.0f)
+            lastNonZero = i;
+
+    REQUIRE(lastNonZero > 0);
+    REQUIRE(lastNonZero < 1056 - 256);
+    REQUIRE_FALSE(gen.isPulseActive());
+
+    // Subsequent stopped blocks are untouched
+    auto idle = makeBuffer(1, 512);
+    gen.process(idle.getNumSamples(), sampleRate, idle);
+    for (int i = 0; i < idle.getNumSamples(); ++i)
+        REQUIRE(idle.getReadPointer(0)[i] == 0.0f);
+}
+
+TEST_CASE("Double-precision processing matches float output", "[pulse]")
+{
+    const double sampleRate = 48000.0;
+    PulseGenerator floatGen, doubleGen;
+
+    for (auto* gen : { &floatGen, &doubleGen })
+    {
+        gen->prepare(sampleRate);
+        gen->setSyncToHost(false);
+        gen->setManualBPM(120.0f);
+        gen->setHostIsPlaying(true);
+    }
+
+    TestBuffer<float> floatBuffer(2, 4096);
+    TestBuffer<double> doubleBuffer(2, 4096);
+
+    floatGen.process(floatBuffer.getArrayOfWritePointers(), floatBuffer.getNumChannels(), floatBuffer.getNumSamples());
+    doubleGen.process(doubleBuffer.getArrayOfWritePointers(), doubleBuffer.getNumChannels(), doubleBuffer.getNumSamples());
+
+    for (int ch = 0; ch < floatBuffer.getNumChannels(); ++ch)
+        for (int i = 0; i < floatBuffer.getNumSamples(); ++i)
+            REQUIRE(static_cast<float>(doubleBuffer.getReadPointer(ch)[i]) == floatBuffer.getReadPointer(ch)[i]);
+}
+
+TEST_CASE("Precomputed pulse table renders the same pulse as direct evaluation", "[pulse]")
+{
+    const double sampleRate = 48000.0;
+    PulseGenerator direct, tabled;
+    PulseTable table(sampleRate, static_cast<int>(sampleRate * 10.0f * 0.001));
+    tabled.setPulseTable(&table);
+
+    for (auto* gen : { &direct, &tabled })
+    {
+        gen->prepare(sampleRate);
+        gen->setPulseWidth(10.0f);
+        gen->setSyncToHost(false);
+        gen->setManualBPM(120.0f);
+        gen->setHostIsPlaying(true);
+    }
+
+    auto directBuffer = makeBuffer(1, 4096);
+    auto tabledBuffer = makeBuffer(1, 4096);
+    direct.process(directBuffer.getNumSamples(), sampleRate, directBuffer);
+    tabled.process(tabledBuffer.getNumSamples(), sampleRate, tabledBuffer);
+
+    for (int i = 0; i < directBuffer.getNumSamples(); ++i)
+        REQUIRE(tabledBuffer.getReadPointer(0)[i] == directBuffer.getReadPointer(0)[i]);
+
+    SECTION("A table for a different width is ignored")
+    {
+        tabled.setPulseWidth(20.0f);
+        direct.setPulseWidth(20.0f);
+        directBuffer.clear();
+        tabledBuffer.clear();
+        direct.process(directBuffer.getNumSamples(), sampleRate, directBuffer);
+        tabled.process(tabledBuffer.getNumSamples(), sampleRate, tabledBuffer);
+
+        for (int i = 0; i < directBuffer.getNumSamples(); ++i)
+            REQUIRE(tabledBuffer.getReadPointer(0)[i] == directBuffer.getReadPointer(0)[i]);
+    }
+}
+
+TEST_CASE("Raw-pointer API renders into caller-owned channels", "[pulse]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setSyncToHost(false);
+    gen.setHostIsPlaying(true);
+
+    std::vector<float> left(512, 0.0f), right(512, 0.0f);
+    float* channels[] = { left.data(), right.data() };
+    gen.process(channels, 2, 512);
+
+    REQUIRE(left == right);
+    REQUIRE(std::any_of(left.begin(), left.end(), [](float s) { return s != 0.0f; }));
+
+    SECTION("Sample-rate change via setSampleRate rescales the pulse length")
+    {
+        gen.setSampleRate(96000.0);
+        REQUIRE(gen.getPulseDurationSamples() == static_cast<int>(96000.0 * gen.getPulseWidth() * 0.001));
+    }
+}
+
+TEST_CASE("Pulse index counts pulse onsets", "[pulse]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulseWidth(5.0f);
+    gen.setHostIsPlaying(true);
+    REQUIRE(gen.getPulseIndex() == -1);
+
+    // 120 BPM at 24 PPQN -> one pulse every 1000 samples, first at sample 0
+    auto buffer = makeBuffer(1, 4500);
+    gen.process(buffer.getNumSamples(), sampleRate, buffer);
+    REQUIRE(gen.getPulseIndex() == 4);
+
+    gen.reset();
+    REQUIRE(gen.getPulseIndex() == -1);
+}
+
+TEST_CASE("Transport jumps realign the pulse index to the host grid", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulseWidth(5.0f);
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(120.0);
+
+    // Start at PPQ 0 and play two beats (48 pulses, 1000 samples apart)
+    auto buffer = makeBuffer(1, 1000);
+    for (int block = 0; block < 48; ++block)
+    {
+        gen.setHostPPQPosition(block / 24.0);
+        buffer.clear();
+        gen.process(buffer.getNumSamples(), sampleRate, buffer);
+    }
+    REQUIRE(gen.getPulseIndex() == 47);
+
+    SECTION("Relocating forward")
+    {
+        gen.setHostPPQPosition(10.0);
+        buffer.clear();
+        gen.process(buffer.getNumSamples(), sampleRate, buffer);
+        REQUIRE(gen.getPulseIndex() == 240);
+    }
+
+    SECTION("Rewinding to the start")
+    {
+        gen.setHostPPQPosition(0.0);
+        buffer.clear();
+        gen.process(buffer.getNumSamples(), sampleRate, buffer);
+        REQUIRE(gen.getPulseIndex() == 0);
+        REQUIRE(buffer.getReadPointer(0)[1] != 0.0f); // The pulse at PPQ 0 sounds again
+    }
+}
+
+TEST_CASE("A pulse wider than the pulse interval is cut short by the next one", "[pulse]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setSyncToHost(false);
+    gen.setManualBPM(200.0f);
+    gen.setPulsesPerQuarterNote(96.0); // 150 samples between pulses
+    gen.setPulseWidth(50.0f);          // 2400 samples per pulse
+    gen.setHostIsPlaying(true);
+
+    auto buffer = makeBuffer(1, 1500);
+    gen.process(buffer.getNumSamples(), sampleRate, buffer);
+    REQUIRE(gen.getPulseIndex() == 9);
+
+    // Every tick restarts the pulse on the grid instead of overlapping the previous one
+    const auto* data = buffer.getReadPointer(0);
+    for (int pulse = 1; pulse < 10; ++pulse)
+        for (int i = 0; i < 150; ++i)
+            REQUIRE(data[pulse * 150 + i] == data[i]);
+}
+
+TEST_CASE("A sample-rate change mid-stream keeps the pulse phase", "[pulse]")
+{
+    PulseGenerator gen;
+    gen.prepare(48000.0);
+    gen.setSyncToHost(false);
+    gen.setManualBPM(120.0f);
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+
+    // Pulses at 0, 1000 and 2000; the next one is due 500 samples (10.4 ms) after this block
+    auto before = makeBuffer(1, 2500);
+    gen.process(before.getNumSamples(), 48000.0, before);
+    REQUIRE(findOnsets(before) == std::vector<int>({ 0, 1000, 2000 }));
+
+    // At 96 kHz the same musical time is 1000 samples away, then every 2000 samples
+    auto after = makeBuffer(1, 4000);
+    gen.process(after.getNumSamples(), 96000.0, after);
+    REQUIRE(findOnsets(after) == std::vector<int>({ 1000, 3000 }));
+    REQUIRE(gen.getPulseIndex() == 4);
+
+    SECTION("A pulse that has just started keeps sounding instead of restarting")
+    {
+        auto start = makeBuffer(1, 1002); // Two samples into the next pulse
+        gen.process(start.getNumSamples(), 96000.0, start);
+
+        auto rest = makeBuffer(1, 100);
+        gen.process(rest.getNumSamples(), 22050.0, rest);
+        REQUIRE(findOnsets(rest).empty());
+        REQUIRE(rest.getReadPointer(0)[0] != 0.0f);
+    }
+}
+
+TEST_CASE("Editing the manual BPM changes the pulse rate from the next pulse", "[pulse]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setSyncToHost(false);
+    gen.setManualBPM(120.0f);
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+
+    auto before = makeBuffer(1, 2500);
+    gen.process(before.getNumSamples(), sampleRate, before);
+    REQUIRE(gen.getPulseRate() == Catch::Approx(48.0));
+
+    // The pulse already scheduled at 3000 stays put; 60 BPM spaces the following ones 2000 apart
+    gen.setManualBPM(60.0f);
+    auto after = makeBuffer(1, 3000);
+    gen.process(after.getNumSamples(), sampleRate, after);
+    REQUIRE(gen.getPulseRate() == Catch::Approx(24.0));
+    REQUIRE(findOnsets(after) == std::vector<int>({ 500, 2500 }));
+}
+
+TEST_CASE("A host without a PPQ position leaves the engine free-running", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(120.0);
+
+    auto buffer = makeBuffer(1, 1000);
+    for (int block = 0; block < 3; ++block)
+    {
+        gen.setHostPPQPosition(block / 24.0);
+        buffer.clear();
+        gen.process(buffer.getNumSamples(), sampleRate, buffer);
+    }
+    REQUIRE(gen.getPulseIndex() == 2);
+
+    // The PPQ drops out: ticks continue at the host tempo instead of realigning to the stale position
+    gen.clearHostPPQPosition();
+    for (int block = 3; block < 8; ++block)
+    {
+        buffer.clear();
+        gen.process(buffer.getNumSamples(), sampleRate, buffer);
+        REQUIRE(findOnsets(buffer) == std::vector<int>({ 0 }));
+    }
+    REQUIRE(gen.getPulseIndex() == 7);
+}
+
+TEST_CASE("A host tempo change realigns with the new pulse interval", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(120.0);
+
+    // 2500 samples at 120 BPM: halfway between the pulses at PPQ 2/24 and 3/24
+    double ppq = 0.0;
+    for (const int numSamples : { 1000, 1000, 500 })
+    {
+        auto buffer = makeBuffer(1, numSamples);
+        gen.setHostPPQPosition(ppq);
+        gen.process(buffer.getNumSamples(), sampleRate, buffer);
+        ppq += numSamples / 24000.0;
+    }
+    REQUIRE(gen.getPulseIndex() == 2);
+
+    // At 60 BPM the rest of that half pulse takes 1000 samples, then pulses are 2000 apart
+    gen.setHostTempo(60.0);
+    gen.setHostPPQPosition(ppq);
+    auto buffer = makeBuffer(1, 3500);
+    gen.process(buffer.getNumSamples(), sampleRate, buffer);
+    REQUIRE(findOnsets(buffer) == std::vector<int>({ 1000, 3000 }));
+    REQUIRE(gen.getPulseIndex() == 4);
+}
+
+TEST_CASE("An overdue tick after a tempo change plays at once without moving the grid", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(120.0);
+    gen.setHostPPQPosition(0.0);
+
+    auto before = makeBuffer(1, 2990); // Pulses at 0, 1000 and 2000; the next is due at 3000
+    gen.process(before.getNumSamples(), sampleRate, before);
+
+    // The host reports 20 samples past that pulse and halves the tempo
+    gen.setHostTempo(60.0);
+    gen.setHostPPQPosition(3010.0 / 24000.0);
+    auto after = makeBuffer(1, 2500);
+    gen.process(after.getNumSamples(), sampleRate, after);
+    REQUIRE(findOnsets(after) == std::vector<int>({ 0, 1980 }));
+    REQUIRE(gen.getPulseIndex() == 4);
+}
+
+TEST_CASE("A tempo drop right after a jittered early tick does not play it again", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulsesPerQuarterNote(960.0); // 25 samples per pulse at 120 BPM
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(120.0);
+    gen.setHostPPQPosition(0.0);
+
+    auto before = makeBuffer(1, 2990); // Pulses 0 to 119; pulse 120 is due at 3000
+    gen.process(before.getNumSamples(), sampleRate, before);
+
+    // The host reports 20 samples ahead: pulse 120 plays 10 samples early
+    gen.setHostPPQPosition(3010.0 / 24000.0);
+    auto early = makeBuffer(1, 10);
+    gen.process(early.getNumSamples(), sampleRate, early);
+    REQUIRE(gen.getPulseIndex() == 120);
+
+    // Back on time, and six times slower: 20 samples at the old tempo are 120 at the new one,
+    // but the host only ran those 20, so this is still jitter and pulse 120 is not repeated
+    gen.setHostTempo(20.0);
+    gen.setHostPPQPosition(3000.0 / 24000.0);
+    auto after = makeBuffer(1, 400);
+    gen.process(after.getNumSamples(), sampleRate, after);
+    REQUIRE(findOnsets(after) == std::vector<int>({ 150, 300 }));
+    REQUIRE(gen.getPulseIndex() == 122);
+}
+
+TEST_CASE("A tempo rise right after a jittered late report does not play the last tick again", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulsesPerQuarterNote(960.0); // 150 samples per pulse at 20 BPM, 25 at 120 BPM
+    gen.setPulseWidth(1.0f);
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(20.0);
+    gen.setHostPPQPosition(0.0);
+
+    auto before = makeBuffer(1, 3010); // Pulses 0 to 20; pulse 20 plays at 3000
+    gen.process(before.getNumSamples(), sampleRate, before);
+
+    // Six times faster, reported 20 samples late at the new tempo (120 at the old one),
+    // which puts the host back in pulse 19
+    gen.setHostTempo(120.0);
+    gen.setHostPPQPosition(3010.0 / 144000.0 - 20.0 / 24000.0);
+    auto after = makeBuffer(1, 100);
+    gen.process(after.getNumSamples(), sampleRate, after);
+    REQUIRE(findOnsets(after) == std::vector<int>({ 44, 69, 94 }));
+    REQUIRE(gen.getPulseIndex() == 23);
+}
+
+TEST_CASE("Moving back within the pulse that just played does not play it again", "[pulse][sync]")
+{
+    PulseGenerator gen;
+    const double sampleRate = 48000.0;
+    gen.prepare(sampleRate);
+    gen.setPulseWidth(10.0f); // 480 samples of the 1000-sample interval
+    gen.setHostIsPlaying(true);
+    gen.setHostTempo(120.0);
+    gen.setHostPPQPosition(0.0);
+
+    auto before = makeBuffer(1, 700); // Pulse 0 plays and ends
+    gen.process(before.getNumSamples(), sampleRate, before);
+
+    // The host steps back 300 samples, into the span pulse 0 sounded in
+    gen.setHostPPQPosition(400.0 / 24000.0);
+    auto after = makeBuffer(1, 1000);
+    gen.process(after.getNumSamples(), sampleRate, after);
+    REQUIRE(findOnsets(after) == std::vector<int>({ 600 }));
+    REQUIRE(after.getReadPointer(0)[0] == 0.0f);
+    REQUIRE(gen.getPulseIndex() == 1);
+}
+
+TEST_CASE("Host PPQ jitter neither repeats nor drops ticks", "[pulse][sync]")
+{
+    const double sampleRate = 48000.0;
+    const double bpm = 120.0;
+    const int blockSize = 256;
+    const int numBlocks = static_cast<int>(60.0 * sampleRate) / blockSize; // One minute
+
+    for (const double ppqn : { 24.0, 960.0 })
+    {
+        for (const int jitterSamples : { 0, 2, 8 })
+        {
+            PulseGenerator gen;
+            gen.prepare(sampleRate);
+            gen.setPulsesPerQuarterNote(ppqn);
+            gen.setPulseWidth(1.0f); // Wider than the 25-sample interval at 960 PPQN
+            gen.setHostIsPlaying(true);
+            gen.setHostTempo(bpm);
+
+            std::mt19937 rng(1234);
+            std::uniform_int_distribution<int> jitter(-jitterSamples, jitterSamples);
+
+            auto buffer = makeBuffer(1, blockSize);
+            float previous = 0.0f;
+            std::int64_t onsets = 0;
+
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                // The host reports its position a few samples off, around the true one
+                // (exactly at the start and in the last block, so no tick crosses the ends)
+                const bool exact = block == 0 || block == numBlocks - 1;
+                const int reportedSample = block * blockSize + (exact ? 0 : jitter(rng));
+                gen.setHostPPQPosition(reportedSample * bpm / (60.0 * sampleRate));
+
+                buffer.clear();
+                gen.process(buffer.getNumSamples(), sampleRate, buffer);
+
+                // Every pulse starts from silence or from the cut-short previous pulse at phase 0
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    const float sample = buffer.getReadPointer(0)[i];
+                    if (sample != 0.0f && previous == 0.0f)
+                        ++onsets;
+                    previous = sample;
+                }
+            }
+
+            INFO("PPQN " << ppqn << ", jitter +/-" << jitterSamples << " samples");
+            const auto expectedTicks = static_cast<std::int64_t>(std::ceil(numBlocks * blockSize * bpm / 60.0 / sampleRate * ppqn));
+            REQUIRE(onsets == expectedTicks);
+            REQUIRE(gen.getPulseIndex() == expectedTicks - 1);
+        }
+    }
+}
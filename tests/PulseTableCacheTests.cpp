@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "PulseTableCache.h"
+
+TEST_CASE("Pulse table cache builds each key once", "[tables]")
+{
+    PulseTableCache cache;
+
+    auto table = cache.getOrBuild(48000.0, 1056);
+    REQUIRE(table != nullptr);
+    REQUIRE(table->table.matches(48000.0, 1056));
+    REQUIRE(cache.getOrBuild(48000.0, 1056) == table);
+    REQUIRE(cache.getNumTables() == 1);
+
+    SECTION("Different sample rate or width gets its own table")
+    {
+        auto otherRate = cache.getOrBuild(44100.0, 1056);
+        auto otherWidth = cache.getOrBuild(48000.0, 480);
+        REQUIRE(otherRate != table);
+        REQUIRE(otherWidth != table);
+        REQUIRE(cache.getNumTables() == 3);
+    }
+}
+
+TEST_CASE("Pulse table cache frees tables nobody holds", "[tables]")
+{
+    PulseTableCache cache;
+    auto held = cache.getOrBuild(48000.0, 1056);
+
+    // A width sweep: each step's table is dropped by the caller before the next is built
+    for (int durationSamples = 48; durationSamples <= 2400; ++durationSamples)
+        cache.getOrBuild(48000.0, durationSamples);
+
+    REQUIRE(cache.getNumTables() <= 2);
+    REQUIRE(cache.getOrBuild(48000.0, 1056) == held);
+
+    held = nullptr;
+    cache.releaseUnused();
+    REQUIRE(cache.getNumTables() == 0);
+}
+
+TEST_CASE("Pulse table cache is shared between holders", "[tables]")
+{
+    juce::SharedResourcePointer<PulseTableCache> first;
+    juce::SharedResourcePointer<PulseTableCache> second;
+
+    REQUIRE(&first.get() == &second.get());
+
+    auto table = first->getOrBuild(96000.0, 2112);
+    REQUIRE(second->getOrBuild(96000.0, 2112) == table);
+}
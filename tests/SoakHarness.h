@@ -0,0 +1,188 @@
+#pragma once
+
+// Shared pieces for the randomized soak tests (Catch tag [soak], CTest label "soak")
+// - Each test case runs until its time box expires: PULSE24SYNC_SOAK_SECONDS (default 10)
+// - Randomness is seeded from Catch's --rng-seed, so a failing run can be replayed
+// - JUCE-free so the engine soak builds against Pulse24SyncCore alone
+
+#include <catch2/catch_get_random_seed.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+namespace Soak
+{
+    inline double getTimeBudgetSeconds()
+    {
+        if (const char* env = std::getenv("PULSE24SYNC_SOAK_SECONDS"))
+            if (const double seconds = std::atof(env); seconds > 0.0)
+                return seconds;
+
+        return 10.0;
+    }
+
+    class Deadline
+    {
+    public:
+        Deadline()
+            : end(std::chrono::steady_clock::now()
+                  + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                      std::chrono::duration<double>(getTimeBudgetSeconds())))
+        {
+        }
+        bool expired() const { return std::chrono::steady_clock::now() >= end; }
+
+    private:
+        std::chrono::steady_clock::time_point end;
+    };
+
+    inline std::mt19937 makeRandom() { return std::mt19937(Catch::getSeed()); }
+
+    inline bool chance(std::mt19937& rng, double probability)
+    {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(rng) < probability;
+    }
+
+    template <typename T>
+    T pick(std::mt19937& rng, std::initializer_list<T> values)
+    {
+        auto index = std::uniform_int_distribution<size_t>(0, values.size() - 1)(rng);
+        return *(values.begin() + index);
+    }
+
+    // Adversarial host block sizes: single samples, small odd sizes, usual powers of two, large random
+    inline int randomBlockSize(std::mt19937& rng, int maxBlockSize)
+    {
+        switch (std::uniform_int_distribution<int>(0, 3)(rng))
+        {
+            case 0:  return 1;
+            case 1:  return 2 * std::uniform_int_distribution<int>(0, 63)(rng) + 1;
+            case 2:  return pick(rng, { 32, 64, 128, 256, 512, 1024 });
+            default: return std::uniform_int_distribution<int>(1, maxBlockSize)(rng);
+        }
+    }
+
+    inline double randomSampleRate(std::mt19937& rng)
+    {
+        return pick(rng, { 22050.0, 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 });
+    }
+
+    inline double randomTempo(std::mt19937& rng)
+    {
+        return std::uniform_real_distribution<double>(30.0, 300.0)(rng);
+    }
+
+    // Host transport model: PPQ advances with tempo at the current sample rate. Like
+    // real hosts, it reports that position up to jitterSamples off (rounding, latency
+    // compensation), independently for every block.
+    struct Transport
+    {
+        double bpm = 120.0;
+        double ppq = 0.0;
+        int jitterSamples = 0;
+
+        void advance(int numSamples, double sampleRate) { ppq += numSamples * bpm / (60.0 * sampleRate); }
+
+        double reportPpq(std::mt19937& rng, double sampleRate) const
+        {
+            const int error = std::uniform_int_distribution<int>(-jitterSamples, jitterSamples)(rng);
+            return std::max(0.0, ppq + error * bpm / (60.0 * sampleRate));
+        }
+    };
+
+    // Audits the ticks heard in rendered audio against the host grid.
+    // - Every pulse starts at sine phase 0, so an onset is an audible sample after a
+    //   silent one: after silence, or after the first sample of a pulse that cuts the
+    //   previous one short
+    // - Onsets are compared with the grid ticks (pulse k at PPQ k / PPQN) over a stretch
+    //   of uninterrupted synced playback. A tick within the host jitter of either end of
+    //   the stretch may fall on either side of it, as may one within a few samples:
+    //   onsets land on whole samples and are heard one sample late.
+    class TickAudit
+    {
+    public:
+        explicit TickAudit(int hostJitterSamples) : jitterSamples(hostJitterSamples) {}
+
+        template <typename SampleType>
+        void addAudio(const SampleType* data, int numSamples)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                if (data[i] != SampleType(0) && previousWasZero)
+                    ++onsets;
+
+                previousWasZero = data[i] == SampleType(0);
+            }
+        }
+
+        // The next update() starts a new stretch (after a jump, a PPQ gap or any other interruption)
+        void restart() { stretchStarted = false; }
+
+        // Call after every block with the host state at its end. Returns how many ticks
+        // the stretch is off beyond what a tick near either of its ends allows (0 = pass).
+        std::int64_t update(double ppq, double ppqn, double bpm, double sampleRate)
+        {
+            // Jitter absorbed at a low rate spans more samples at a higher one, and a tick
+            // late from before a tempo change is judged at the shorter interval
+            lowestSampleRate = std::min(lowestSampleRate, sampleRate);
+            const double samplesPerPulse = sampleRate * 60.0 / (bpm * ppqn);
+            const double shortestSamplesPerPulse = previousSamplesPerPulse > 0.0 ? std::min(samplesPerPulse, previousSamplesPerPulse)
+                                                                                  : samplesPerPulse;
+            previousSamplesPerPulse = samplesPerPulse;
+
+            const double pulses = ppq * ppqn;
+            const double toleranceSamples = jitterSamples * sampleRate / lowestSampleRate + 3.0;
+            const bool nearTick = std::abs(pulses - std::round(pulses)) * shortestSamplesPerPulse <= toleranceSamples;
+
+            if (!stretchStarted)
+            {
+                stretchStarted = true;
+                startTicks = ticksBefore(pulses);
+                startOnsets = onsets;
+                startNearTick = nearTick;
+                onsetsInStretch = ticksInStretch = 0;
+                return 0;
+            }
+
+            onsetsInStretch = onsets - startOnsets;
+            ticksInStretch = ticksBefore(pulses) - startTicks;
+
+            const std::int64_t allowedError = (startNearTick ? 1 : 0) + (nearTick ? 1 : 0);
+            return std::max<std::int64_t>(0, std::abs(onsetsInStretch - ticksInStretch) - allowedError);
+        }
+
+        std::int64_t getOnsetsInStretch() const { return onsetsInStretch; }
+        std::int64_t getTicksInStretch() const { return ticksInStretch; }
+
+    private:
+        static std::int64_t ticksBefore(double pulses) { return static_cast<std::int64_t>(std::ceil(pulses - 1.0e-9)); }
+
+        int jitterSamples = 0;
+        std::int64_t onsets = 0;
+        bool previousWasZero = true;
+
+        double lowestSampleRate = std::numeric_limits<double>::max();
+        double previousSamplesPerPulse = 0.0;
+
+        bool stretchStarted = false;
+        bool startNearTick = false;
+        std::int64_t startTicks = 0, startOnsets = 0;
+        std::int64_t onsetsInStretch = 0, ticksInStretch = 0;
+    };
+
+    // Returns false on NaN/Inf or any sample beyond +/- limit
+    template <typename SampleType>
+    bool isFiniteAndBounded(const SampleType* data, int numSamples, double limit)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            if (!std::isfinite(data[i]) || std::abs(static_cast<double>(data[i])) > limit)
+                return false;
+
+        return true;
+    }
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include "Renderer/StemRenderer.h"
+
+TEST_CASE("Rendered ticks land on the tempo map's grid", "[render]")
+{
+    juce::TemporaryFile tempFile(".wav");
+
+    // Changes away from block and pulse boundaries; at 96 PPQN several ticks fall
+    // between a change and the start of the next 4096-sample block
+    TempoMap tempoMap(120.0);
+    tempoMap.addChange(4.3, 97.0);
+    tempoMap.addChange(9.71, 173.0);
+
+    StemSettings settings;
+    settings.outputFile = tempFile.getFile();
+    settings.sampleRate = 48000.0;
+    settings.bitsPerSample = 32; // Float samples, so each pulse's silent first sample stays silent
+    settings.pulsesPerQuarterNote = 96.0;
+    settings.pulseWidthMs = 1.0f;
+    settings.durationSeconds = 8.0;
+    settings.blockSize = 4096;
+
+    const auto stem = renderStem(settings, tempoMap);
+    REQUIRE(stem.result.wasOk());
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatReader> reader(wav.createReaderFor(settings.outputFile.createInputStream().release(), true));
+    REQUIRE(reader != nullptr);
+
+    const auto numSamples = static_cast<int>(reader->lengthInSamples);
+    juce::AudioBuffer<float> audio(1, numSamples);
+    reader->read(&audio, 0, numSamples, 0, true, false);
+
+    // A pulse starts at sine phase 0: its onset is the silent sample before the first audible one
+    std::vector<int> onsets;
+    const auto* data = audio.getReadPointer(0);
+    for (int i = 1; i < numSamples; ++i)
+        if (data[i] != 0.0f && data[i - 1] == 0.0f)
+            onsets.push_back(i - 1);
+
+    // Tick k is due at PPQ k / PPQN and starts on the first sample at or after that time
+    size_t numTicks = 0;
+    for (;; ++numTicks)
+    {
+        const double tickSample = tempoMap.getTimeAtPpq(static_cast<double>(numTicks) / settings.pulsesPerQuarterNote)
+                                * settings.sampleRate;
+        if (tickSample >= numSamples - 2) // Too close to the end to see its onset
+            break;
+
+        INFO("tick " << numTicks << " due at sample " << tickSample);
+        REQUIRE(numTicks < onsets.size());
+        REQUIRE(onsets[numTicks] > tickSample - 0.01);
+        REQUIRE(onsets[numTicks] < tickSample + 1.01);
+    }
+
+    REQUIRE(onsets.size() == numTicks);
+}
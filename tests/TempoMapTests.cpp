@@ -0,0 +1,70 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <sstream>
+
+#include "TempoMap.h"
+
+TEST_CASE("Constant tempo maps seconds to PPQ linearly", "[tempo]")
+{
+    TempoMap map(120.0);
+
+    REQUIRE(map.getTempoAtTime(10.0) == Catch::Approx(120.0));
+    REQUIRE(map.getPpqAtTime(1.0) == Catch::Approx(2.0));
+    REQUIRE(map.getTimeAtPpq(8.0) == Catch::Approx(4.0));
+}
+
+TEST_CASE("Tempo changes are integrated piecewise", "[tempo]")
+{
+    TempoMap map(120.0);
+    map.addChange(8.0, 60.0); // 8 beats at 120 = 4s, then 1 beat per second
+
+    REQUIRE(map.getTempoAtTime(3.9) == Catch::Approx(120.0));
+    REQUIRE(map.getTempoAtTime(4.1) == Catch::Approx(60.0));
+    REQUIRE(map.getPpqAtTime(4.0) == Catch::Approx(8.0));
+    REQUIRE(map.getPpqAtTime(6.0) == Catch::Approx(10.0));
+    REQUIRE(map.getTimeAtPpq(10.0) == Catch::Approx(6.0));
+}
+
+TEST_CASE("The next tempo change after a time", "[tempo]")
+{
+    TempoMap map(120.0);
+    REQUIRE(std::isinf(map.getNextChangeTimeAfter(0.0)));
+
+    map.addChange(8.0, 60.0);  // At 4s
+    map.addChange(10.0, 90.0); // At 6s
+
+    REQUIRE(map.getNextChangeTimeAfter(0.0) == Catch::Approx(4.0));
+    REQUIRE(map.getNextChangeTimeAfter(4.0) == Catch::Approx(6.0)); // Strictly after
+    REQUIRE(map.getNextChangeTimeAfter(5.0) == Catch::Approx(6.0));
+    REQUIRE(std::isinf(map.getNextChangeTimeAfter(6.0)));
+}
+
+TEST_CASE("Tempo map CSV parsing", "[tempo]")
+{
+    TempoMap map;
+    std::string error;
+
+    SECTION("Header, comments and unsorted rows")
+    {
+        std::istringstream csv("beat,bpm\n# intro\n16,140\n0,100\n\n");
+        REQUIRE(TempoMap::parseCsv(csv, map, error));
+        REQUIRE(map.getNumChanges() == 2);
+        REQUIRE(map.getTempoAtTime(0.0) == Catch::Approx(100.0));
+        REQUIRE(map.getTimeAtPpq(16.0) == Catch::Approx(9.6));
+    }
+
+    SECTION("Malformed rows are reported with their line number")
+    {
+        std::istringstream csv("0,120\n4;90\n");
+        REQUIRE_FALSE(TempoMap::parseCsv(csv, map, error));
+        REQUIRE(error.find("line 2") != std::string::npos);
+    }
+
+    SECTION("Non-positive tempo is rejected")
+    {
+        std::istringstream csv("0,0\n");
+        REQUIRE_FALSE(TempoMap::parseCsv(csv, map, error));
+    }
+}